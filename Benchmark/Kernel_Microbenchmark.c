@@ -0,0 +1,268 @@
+/*
+ * Kernel_Microbenchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Youssef Samy
+ */
+
+/*
+	Kernel Microbenchmarks (Replaces Src/main.c in the Benchmark Build , See README.md):
+	---------------------------------------------------------------------------------
+	The Controller Task (Priority 10) measures the Kernel Core Costs with the help of:
+	* High_Task  (Priority 5)  ===> Stamps the Time as soon as it Runs , then Terminates itself (Back to the Controller)
+	* Mutex_Task (Priority 5)  ===> Blocks on the Mutex held by the Controller , Stamps the Time when it gets the Mutex
+	* Low_Task   (Priority 20) ===> Activated/Terminated without ever Running (No Context Switching)
+
+	Metrics:
+	* Timestamp_Overhead   : 2 back-to-back Timestamps
+	* SVC_Entry_Exit       : SVC with an Invalid Service Number (Entry , Dispatch check and Exit only)
+	* Activate_No_Switch   : Activating a Lower Priority Task
+	* Activate_To_Run      : Activating a Higher Priority Task , until it Runs
+	* Context_Switch       : PendSV Save/Restore , Pended by the Controller itself (Cortex-M3 only , See Bench_Measure_Context_Switch)
+	* Terminate_To_Run     : a Task Terminating itself , until the Controller Runs
+	* Mutex_Acquire/Release: Uncontended Mutex
+	* Mutex_Acquire_Block  : Acquiring a Taken Mutex , until the Owner Runs
+	* Mutex_Release_Handoff: Releasing a Mutex having a Waiter , until the Waiter Runs
+	* Tick_ISR             : Systick Handler (No Context Switching) , measured as the gap it makes in a Timestamp loop
+	Samples interrupted by a Systick are discarded (except for the Tick_ISR).
+*/
+
+#include "Samy_OS_Benchmark.h"
+
+
+typedef enum
+{
+	Bench_Timestamp_Overhead,
+	Bench_SVC_Entry_Exit,
+	Bench_Activate_No_Switch,
+	Bench_Activate_To_Run,
+	Bench_Context_Switch,
+	Bench_Terminate_To_Run,
+	Bench_Mutex_Acquire,
+	Bench_Mutex_Release,
+	Bench_Mutex_Acquire_Block,
+	Bench_Mutex_Release_Handoff,
+	Bench_Tick_ISR,
+
+	Bench_Metrics_Num
+}Bench_Metric_ID;
+
+static const char *const Bench_Metric_Names[Bench_Metrics_Num] =
+{
+	"Timestamp_Overhead",
+	"SVC_Entry_Exit",
+	"Activate_No_Switch",
+	"Activate_To_Run",
+	"Context_Switch",
+	"Terminate_To_Run",
+	"Mutex_Acquire",
+	"Mutex_Release",
+	"Mutex_Acquire_Block",
+	"Mutex_Release_Handoff",
+	"Tick_ISR",
+};
+
+#define BENCH_INVALID_SERVICE		0xFFFFFFFF
+
+static Bench_Stats Stats[Bench_Metrics_Num];
+
+static Tasks_ref Controller_Task , High_Task , Mutex_Task , Low_Task;
+static Mutex_ref Bench_Mutex;
+
+static volatile uint32 High_Task_Stamp , Mutex_Task_Stamp;
+
+/****************************************************************************************************************************/
+
+static void High_Task_func(void)
+{
+	while(1)
+	{
+		// End of Activate_To_Run , and Start of Terminate_To_Run
+		High_Task_Stamp = Bench_Timestamp();
+		Samy_OS_Terminate_Task(&High_Task);
+	}
+}
+
+static void Mutex_Task_func(void)
+{
+	while(1)
+	{
+		// Start of Mutex_Acquire_Block (the Controller holds the Mutex)
+		Mutex_Task_Stamp = Bench_Timestamp();
+		Samy_OS_Acquire_Mutex(&Mutex_Task, &Bench_Mutex);
+
+		// End of Mutex_Release_Handoff
+		Mutex_Task_Stamp = Bench_Timestamp();
+		Samy_OS_Release_Mutex(&Bench_Mutex);
+		Samy_OS_Terminate_Task(&Mutex_Task);
+	}
+}
+
+static void Low_Task_func(void)
+{
+	while(1)
+	{
+
+	}
+}
+
+/****************************************************************************************************************************/
+
+static void Bench_Measure_Overheads(void)
+{
+	uint8 L_Mark = Bench_Tick_Mark();
+	uint32 L_Start , L_End , L_Stamp;
+
+	L_Start = Bench_Timestamp();
+	L_End = Bench_Timestamp();
+	L_Stamp = Bench_Elapsed(L_Start, L_End);
+	if(Bench_Tick_Mark() == L_Mark)
+	{
+		Bench_Stats_Add(&Stats[Bench_Timestamp_Overhead], L_Stamp);
+	}
+
+	L_Mark = Bench_Tick_Mark();
+	L_Start = Bench_Timestamp();
+	OS_SVC_Call(BENCH_INVALID_SERVICE, 0, 0, 0);
+	L_End = Bench_Timestamp();
+	if(Bench_Tick_Mark() == L_Mark)
+	{
+		Bench_Stats_Add(&Stats[Bench_SVC_Entry_Exit], Bench_Elapsed(L_Start, L_End));
+	}
+}
+
+static void Bench_Measure_Activation(void)
+{
+	uint8 L_Mark = Bench_Tick_Mark();
+	uint32 L_Start , L_End , L_No_Switch , L_To_Run , L_Switch;
+
+	// Lower Priority Task ===> the Controller keeps Running
+	L_Start = Bench_Timestamp();
+	Samy_OS_Activate_Task(&Low_Task);
+	L_End = Bench_Timestamp();
+	Samy_OS_Terminate_Task(&Low_Task);
+	L_No_Switch = Bench_Elapsed(L_Start, L_End);
+
+	// Higher Priority Task ===> Runs , and Terminates itself back to the Controller
+	L_Start = Bench_Timestamp();
+	Samy_OS_Activate_Task(&High_Task);
+	L_End = Bench_Timestamp();
+	L_To_Run = Bench_Elapsed(L_Start, High_Task_Stamp);
+
+	if(Bench_Tick_Mark() == L_Mark)
+	{
+		Bench_Stats_Add(&Stats[Bench_Activate_No_Switch], L_No_Switch);
+		Bench_Stats_Add(&Stats[Bench_Activate_To_Run], L_To_Run);
+		Bench_Stats_Add(&Stats[Bench_Terminate_To_Run], Bench_Elapsed(High_Task_Stamp, L_End));
+	}
+
+	L_Switch = Bench_Measure_Context_Switch();
+	if(L_Switch != 0)
+	{
+		Bench_Stats_Add(&Stats[Bench_Context_Switch], L_Switch);
+	}
+}
+
+static void Bench_Measure_Mutex(void)
+{
+	uint8 L_Mark = Bench_Tick_Mark();
+	uint32 L_Start , L_Acquired , L_Released , L_Block , L_Handoff;
+
+	// Uncontended
+	L_Start = Bench_Timestamp();
+	Samy_OS_Acquire_Mutex(&Controller_Task, &Bench_Mutex);
+	L_Acquired = Bench_Timestamp();
+	Samy_OS_Release_Mutex(&Bench_Mutex);
+	L_Released = Bench_Timestamp();
+
+	if(Bench_Tick_Mark() == L_Mark)
+	{
+		Bench_Stats_Add(&Stats[Bench_Mutex_Acquire], Bench_Elapsed(L_Start, L_Acquired));
+		Bench_Stats_Add(&Stats[Bench_Mutex_Release], Bench_Elapsed(L_Acquired, L_Released));
+	}
+
+	// Contended: the Mutex_Task Blocks on the Mutex , then gets it when the Controller Releases it
+	L_Mark = Bench_Tick_Mark();
+	Samy_OS_Acquire_Mutex(&Controller_Task, &Bench_Mutex);
+	Samy_OS_Activate_Task(&Mutex_Task);
+	L_Block = Bench_Elapsed(Mutex_Task_Stamp, Bench_Timestamp());
+
+	L_Start = Bench_Timestamp();
+	Samy_OS_Release_Mutex(&Bench_Mutex);
+	L_Handoff = Bench_Elapsed(L_Start, Mutex_Task_Stamp);
+
+	if(Bench_Tick_Mark() == L_Mark)
+	{
+		Bench_Stats_Add(&Stats[Bench_Mutex_Acquire_Block], L_Block);
+		Bench_Stats_Add(&Stats[Bench_Mutex_Release_Handoff], L_Handoff);
+	}
+}
+
+static void Controller_Task_func(void)
+{
+	uint32 i;
+
+	for(i = 0 ; i < Bench_Metrics_Num ; i++)
+	{
+		Bench_Stats_Init(&Stats[i]);
+	}
+
+	for(i = 0 ; i < BENCH_SAMPLES ; i++)
+	{
+		Bench_Measure_Overheads();
+		Bench_Measure_Activation();
+		Bench_Measure_Mutex();
+		Bench_Stats_Add(&Stats[Bench_Tick_ISR], Bench_Measure_Tick_ISR());
+	}
+
+	Bench_Report_Header();
+	for(i = 0 ; i < Bench_Metrics_Num ; i++)
+	{
+		Bench_Report(Bench_Metric_Names[i], &Stats[i]);
+	}
+	Bench_Report_End();
+
+	Bench_Exit();
+}
+
+/****************************************************************************************************************************/
+
+int main(void)
+{
+	HW_Init();
+
+	if(Samy_OS_Init() != No_Error)
+	{
+		while(1);
+	}
+
+	Controller_Task.Task_Stack_Size = 2048; // printf of the Report
+	Controller_Task.pf_Task_Entry = Controller_Task_func;
+	Controller_Task.Task_Priority = 10;
+
+	High_Task.Task_Stack_Size = 256;
+	High_Task.pf_Task_Entry = High_Task_func;
+	High_Task.Task_Priority = 5;
+
+	Mutex_Task.Task_Stack_Size = 256;
+	Mutex_Task.pf_Task_Entry = Mutex_Task_func;
+	Mutex_Task.Task_Priority = 5;
+
+	Low_Task.Task_Stack_Size = 256;
+	Low_Task.pf_Task_Entry = Low_Task_func;
+	Low_Task.Task_Priority = 20;
+
+	Samy_OS_Create_Task(&Controller_Task);
+	Samy_OS_Create_Task(&High_Task);
+	Samy_OS_Create_Task(&Mutex_Task);
+	Samy_OS_Create_Task(&Low_Task);
+
+	Samy_OS_Activate_Task(&Controller_Task);
+
+	Samy_OS_Start_OS();
+
+	while(1)
+	{
+
+	}
+}
@@ -0,0 +1,249 @@
+/*
+ * Kernel_Scaling_Benchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Youssef Samy
+ */
+
+/*
+	Kernel Scaling Benchmark (Replaces Src/main.c in the Benchmark Build , See README.md):
+	-----------------------------------------------------------------------------------
+	The Controller Task (Priority 10) adds Load Tasks until the OS Tasks Number reaches each Step of Bench_Steps[] ,
+	and measures the Kernel Costs at every Step ===> the Per-Operation Cost Curve versus the Tasks Number.
+
+	Load Tasks (Mixed Priorities and States):
+	* Priority 11 + (Index % 16) ===> Lower than the Controller , So they never disturb a Sample
+	* Every 4th Load Task stays Suspended , the others Wait Periodically for 1 + (Index % 7) ticks
+	  ===> the Waiting List is populated , and the ticks wake-up a variable number of Tasks
+	Before every Sample , the Controller Waits 1 tick to let the Ready Load Tasks Run and go back Waiting.
+
+	Curves (BENCH_CURVE Lines):
+	* SVC_Entry_Exit     : SVC with an Invalid Service Number
+	* Activate_No_Switch : Activating a Lower Priority Task
+	* Activate_To_Run    : Activating a Higher Priority Task , until it Runs
+	* Context_Switch     : PendSV Save/Restore , Pended by the Controller itself (Cortex-M3 only , See Bench_Measure_Context_Switch)
+	* Tick_ISR           : Systick Handler (Waking-up the expired Load Tasks , No Context Switching)
+
+	The Largest Step can be reduced with -DBENCH_MAX_TASKS_NUM=<N> , and the Benchmark stops growing
+	when a Task can't be Created (MAX_TASKS_NUM reached , or no more Stack memory).
+*/
+
+#include "Samy_OS_Benchmark.h"
+
+
+#ifndef BENCH_MAX_TASKS_NUM
+#define BENCH_MAX_TASKS_NUM		MAX_TASKS_NUM
+#endif
+
+#define BENCH_LOAD_STACK_SIZE	128
+#define BENCH_BASE_TASKS_NUM	4 // Idle , Controller , High and Low Tasks
+
+#define BENCH_INVALID_SERVICE	0xFFFFFFFF
+
+typedef enum
+{
+	Bench_SVC_Entry_Exit,
+	Bench_Activate_No_Switch,
+	Bench_Activate_To_Run,
+	Bench_Context_Switch,
+	Bench_Tick_ISR,
+
+	Bench_Curves_Num
+}Bench_Curve_ID;
+
+static const char *const Bench_Curve_Names[Bench_Curves_Num] =
+{
+	"SVC_Entry_Exit",
+	"Activate_No_Switch",
+	"Activate_To_Run",
+	"Context_Switch",
+	"Tick_ISR",
+};
+
+static const uint32 Bench_Steps[] = {BENCH_BASE_TASKS_NUM, 8, 16, 32, 64, BENCH_MAX_TASKS_NUM};
+
+static Bench_Stats Stats[Bench_Curves_Num];
+
+static Tasks_ref Controller_Task , High_Task , Low_Task;
+static Tasks_ref Load_Tasks[MAX_TASKS_NUM];
+static uint32 Load_Tasks_Num;
+
+static volatile uint32 High_Task_Stamp;
+
+/****************************************************************************************************************************/
+
+static void High_Task_func(void)
+{
+	while(1)
+	{
+		High_Task_Stamp = Bench_Timestamp();
+		Samy_OS_Terminate_Task(&High_Task);
+	}
+}
+
+static void Low_Task_func(void)
+{
+	while(1)
+	{
+
+	}
+}
+
+static void Load_Task_func(void)
+{
+	// All the Load Tasks share this Function
+	Tasks_ref *p_Self = Samy_OS_Get_Current_Task();
+	uint32 L_Period = 1 + ((uint32)(p_Self - Load_Tasks) % 7);
+
+	while(1)
+	{
+		Samy_OS_Task_Wait(L_Period, p_Self);
+	}
+}
+
+static Samy_OS_Status Bench_Add_Load_Task(void)
+{
+	Tasks_ref *p_Task = &Load_Tasks[Load_Tasks_Num];
+	Samy_OS_Status L_OS_status;
+
+	p_Task->Task_Stack_Size = BENCH_LOAD_STACK_SIZE;
+	p_Task->pf_Task_Entry = Load_Task_func;
+	p_Task->Task_Priority = 11 + (Load_Tasks_Num % 16);
+
+	L_OS_status = Samy_OS_Create_Task(p_Task);
+	if(L_OS_status == No_Error)
+	{
+		if((Load_Tasks_Num % 4) != 3)
+		{
+			Samy_OS_Activate_Task(p_Task);
+		}
+		Load_Tasks_Num++;
+	}
+
+	return L_OS_status;
+}
+
+/****************************************************************************************************************************/
+
+static void Bench_Measure_Sample(void)
+{
+	uint8 L_Mark;
+	uint32 L_Start , L_End , L_No_Switch , L_To_Run , L_Switch;
+
+	// Let the Ready Load Tasks Run and go back Waiting (the Controller resumes at the Start of a tick)
+	Samy_OS_Task_Wait(1, &Controller_Task);
+
+	L_Mark = Bench_Tick_Mark();
+
+	L_Start = Bench_Timestamp();
+	OS_SVC_Call(BENCH_INVALID_SERVICE, 0, 0, 0);
+	L_End = Bench_Timestamp();
+	if(Bench_Tick_Mark() == L_Mark)
+	{
+		Bench_Stats_Add(&Stats[Bench_SVC_Entry_Exit], Bench_Elapsed(L_Start, L_End));
+	}
+
+	L_Mark = Bench_Tick_Mark();
+
+	L_Start = Bench_Timestamp();
+	Samy_OS_Activate_Task(&Low_Task);
+	L_End = Bench_Timestamp();
+	Samy_OS_Terminate_Task(&Low_Task);
+	L_No_Switch = Bench_Elapsed(L_Start, L_End);
+
+	L_Start = Bench_Timestamp();
+	Samy_OS_Activate_Task(&High_Task);
+	L_To_Run = Bench_Elapsed(L_Start, High_Task_Stamp);
+
+	if(Bench_Tick_Mark() == L_Mark)
+	{
+		Bench_Stats_Add(&Stats[Bench_Activate_No_Switch], L_No_Switch);
+		Bench_Stats_Add(&Stats[Bench_Activate_To_Run], L_To_Run);
+	}
+
+	L_Switch = Bench_Measure_Context_Switch();
+	if(L_Switch != 0)
+	{
+		Bench_Stats_Add(&Stats[Bench_Context_Switch], L_Switch);
+	}
+
+	Bench_Stats_Add(&Stats[Bench_Tick_ISR], Bench_Measure_Tick_ISR());
+}
+
+static void Controller_Task_func(void)
+{
+	uint32 L_Step , i;
+	uint32 L_Tasks_Num = BENCH_BASE_TASKS_NUM;
+	uint8 L_Can_Grow = 1;
+
+	Bench_Report_Header();
+
+	for(L_Step = 0 ; (L_Step < (sizeof(Bench_Steps) / sizeof(Bench_Steps[0]))) && (L_Can_Grow == 1) ; L_Step++)
+	{
+		while(L_Tasks_Num < Bench_Steps[L_Step])
+		{
+			if(Bench_Add_Load_Task() != No_Error)
+			{
+				L_Can_Grow = 0;
+				break;
+			}
+			L_Tasks_Num++;
+		}
+
+		for(i = 0 ; i < Bench_Curves_Num ; i++)
+		{
+			Bench_Stats_Init(&Stats[i]);
+		}
+
+		for(i = 0 ; i < BENCH_SAMPLES ; i++)
+		{
+			Bench_Measure_Sample();
+		}
+
+		for(i = 0 ; i < Bench_Curves_Num ; i++)
+		{
+			Bench_Report_Curve(Bench_Curve_Names[i], L_Tasks_Num, &Stats[i]);
+		}
+	}
+
+	Bench_Report_End();
+
+	Bench_Exit();
+}
+
+/****************************************************************************************************************************/
+
+int main(void)
+{
+	HW_Init();
+
+	if(Samy_OS_Init() != No_Error)
+	{
+		while(1);
+	}
+
+	Controller_Task.Task_Stack_Size = 1024; // printf of the Report
+	Controller_Task.pf_Task_Entry = Controller_Task_func;
+	Controller_Task.Task_Priority = 10;
+
+	High_Task.Task_Stack_Size = 256;
+	High_Task.pf_Task_Entry = High_Task_func;
+	High_Task.Task_Priority = 5;
+
+	Low_Task.Task_Stack_Size = 256;
+	Low_Task.pf_Task_Entry = Low_Task_func;
+	Low_Task.Task_Priority = 30;
+
+	Samy_OS_Create_Task(&Controller_Task);
+	Samy_OS_Create_Task(&High_Task);
+	Samy_OS_Create_Task(&Low_Task);
+
+	Samy_OS_Activate_Task(&Controller_Task);
+
+	Samy_OS_Start_OS();
+
+	while(1)
+	{
+
+	}
+}
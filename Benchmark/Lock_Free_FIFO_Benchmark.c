@@ -0,0 +1,375 @@
+/*
+ * Lock_Free_FIFO_Benchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Youssef Samy
+ */
+
+/*
+	Lock-Free Rings Benchmark (Replaces Src/main.c in the Benchmark Build , See README.md):
+	------------------------------------------------------------------------------------
+	Streams Numbered Items from the Benchmark Interrupts (Bench_Trigger_IRQ) to the Consumer Tasks through the Rings of
+	Samy_OS_Lock_Free_FIFO.h , and checks every Item on the Consumer side:
+	* SPSC_Ring : 1 Producer  (the IRQ line 0)
+	* MPSC_Ring : 2 Producers (the IRQ line 0 , and the IRQ line 1 Triggered in the middle of the line 0 Burst) , checked per Producer
+	The Trigger Task Triggers a Burst of BENCH_BURST Items every tick. Both Rings are BENCH_RING_LENGTH long , and their
+	Free-Running Indices start just below 2^32 ===> the Items go around the Rings many times (Laps) , and the Indices wrap-around.
+
+	Each Consumer Task (Samy_OS_Notify_Task_From_ISR Wake-up) Waits for the first Item of a Burst with _Dequeue_Wait , then
+	Drains the rest of the Burst with _Dequeue. The Producers also exercise:
+	* Full Rings : every BENCH_OVERFLOW_PERIOD ticks , a Burst of BENCH_OVERFLOW_BURST Items (the Refused Items are Sent again)
+	* Timeouts   : every BENCH_PAUSE_PERIOD ticks , the Producers Pause for BENCH_PAUSE_TICKS (the Consumers' Waits expire)
+
+	Report:
+	BENCH,<SPSC|MPSC>_Enqueue_From_ISR / _Dequeue,<min>,<avg>,<max>,<samples>
+	BENCH_FIFO,<Ring>,<Items>,<Laps>,<Order Errors>,<Full>,<Wait Timeouts>     (Order Errors must be 0 , and Items all the Sent Items)
+
+	The Items Number is configurable: -DBENCH_FIFO_ITEMS=<Items of each Producer>
+	Note: on the Host , the IRQ line 1 runs when the line 0 returns (No Nested Interrupts) ===> the MPSC Reservations of
+	the 2 Producers don't Preempt each other as they do on the Cortex-M3.
+*/
+
+#include "Samy_OS_Benchmark.h"
+#include "Samy_OS_Lock_Free_FIFO.h"
+
+
+#ifndef BENCH_FIFO_ITEMS
+#define BENCH_FIFO_ITEMS		10000
+#endif
+
+#define BENCH_RING_LENGTH		16
+#define BENCH_BURST				8
+#define BENCH_OVERFLOW_BURST	20
+#define BENCH_OVERFLOW_PERIOD	16
+#define BENCH_PAUSE_PERIOD		64
+#define BENCH_PAUSE_TICKS		8
+#define BENCH_WAIT_TICKS		4 // Shorter than the Pauses ===> every Pause makes the Waits expire
+
+#define BENCH_START_INDEX		0xFFFFFF00 // the Indices Wrap-around after 256 Items
+
+#define MPSC_PRODUCERS_NUM		2
+#define MPSC_PRODUCER_SHIFT		24 // MPSC Item = (Producer << 24) | Sequence
+
+SPSC_FIFO_DEFINE(SPSC_Ring , uint32 , BENCH_RING_LENGTH)
+MPSC_FIFO_DEFINE(MPSC_Ring , uint32 , BENCH_RING_LENGTH)
+
+typedef struct
+{
+	uint32 Items;			// Received by the Consumer
+	uint32 Order_Errors;	// Items Lost , Duplicated or out of order
+	uint32 Full;			// Enqueues Refused by a Full Ring
+	uint32 Wait_Timeouts;
+	Bench_Stats Enqueue;
+	Bench_Stats Dequeue;
+}Ring_Check_ref;
+
+static Tasks_ref Controller_Task , Trigger_Task , SPSC_Consumer_Task , MPSC_Consumer_Task;
+
+static SPSC_Ring_t SPSC_Ring;
+static MPSC_Ring_t MPSC_Ring;
+
+static volatile Ring_Check_ref SPSC_Check , MPSC_Check;
+
+static uint32 SPSC_Sent;
+static uint32 MPSC_Sent[MPSC_PRODUCERS_NUM];
+static vuint32 Producers_Burst;
+static uint32 SPSC_Expected;
+static uint32 MPSC_Expected[MPSC_PRODUCERS_NUM];
+
+/****************************************************************************************************************************/
+
+static void Bench_SPSC_Produce(void)
+{
+	uint32 L_Start , L_End;
+
+	if(SPSC_Sent < BENCH_FIFO_ITEMS)
+	{
+		L_Start = Bench_Timestamp();
+		if(SPSC_Ring_Enqueue_From_ISR(&SPSC_Ring, SPSC_Sent) == QUEUE_NO_ERROR)
+		{
+			L_End = Bench_Timestamp();
+			Bench_Stats_Add((Bench_Stats*)&SPSC_Check.Enqueue, Bench_Elapsed(L_Start, L_End));
+			SPSC_Sent++;
+		}
+		else
+		{
+			SPSC_Check.Full++;
+		}
+	}
+}
+
+static void Bench_MPSC_Produce(uint32 producer)
+{
+	uint32 L_Start , L_End;
+
+	if(MPSC_Sent[producer] < BENCH_FIFO_ITEMS)
+	{
+		L_Start = Bench_Timestamp();
+		if(MPSC_Ring_Enqueue_From_ISR(&MPSC_Ring, (producer << MPSC_PRODUCER_SHIFT) | MPSC_Sent[producer]) == QUEUE_NO_ERROR)
+		{
+			L_End = Bench_Timestamp();
+			Bench_Stats_Add((Bench_Stats*)&MPSC_Check.Enqueue, Bench_Elapsed(L_Start, L_End));
+			MPSC_Sent[producer]++;
+		}
+		else
+		{
+			MPSC_Check.Full++;
+		}
+	}
+}
+
+// The SPSC Producer , and the MPSC Producer 0 (Interrupt Context: the IRQ line 0)
+static void Bench_IRQ0_Producers(void)
+{
+	uint32 i;
+
+	for(i = 0 ; i < Producers_Burst ; i++)
+	{
+		Bench_SPSC_Produce();
+		Bench_MPSC_Produce(0);
+
+		if(i == (Producers_Burst / 2))
+		{
+			// The MPSC Producer 1 Preempts the Producer 0 in the middle of its Burst
+			Bench_Trigger_IRQ(1);
+		}
+	}
+}
+
+// The MPSC Producer 1 (Interrupt Context: the IRQ line 1)
+static void Bench_IRQ1_Producer(void)
+{
+	uint32 i;
+
+	for(i = 0 ; i < Producers_Burst ; i++)
+	{
+		Bench_MPSC_Produce(1);
+	}
+}
+
+static void Trigger_Task_func(void)
+{
+	uint32 L_Ticks = 0;
+
+	while(1)
+	{
+		Samy_OS_Task_Wait(1, &Trigger_Task);
+		L_Ticks++;
+
+		if((L_Ticks % BENCH_PAUSE_PERIOD) >= BENCH_PAUSE_TICKS)
+		{
+			Producers_Burst = ((L_Ticks % BENCH_OVERFLOW_PERIOD) == 0) ? BENCH_OVERFLOW_BURST : BENCH_BURST;
+			Bench_Trigger_IRQ(0);
+		}
+	}
+}
+
+/****************************************************************************************************************************/
+
+static void Bench_SPSC_Check_Item(uint32 item)
+{
+	if(item != SPSC_Expected)
+	{
+		SPSC_Check.Order_Errors++;
+	}
+	SPSC_Expected = item + 1;
+	SPSC_Check.Items++;
+}
+
+static void Bench_MPSC_Check_Item(uint32 item)
+{
+	uint32 L_Producer = item >> MPSC_PRODUCER_SHIFT;
+	uint32 L_Sequence = item & ((1UL << MPSC_PRODUCER_SHIFT) - 1);
+
+	if((L_Producer >= MPSC_PRODUCERS_NUM) || (L_Sequence != MPSC_Expected[L_Producer]))
+	{
+		MPSC_Check.Order_Errors++;
+	}
+	else
+	{
+		MPSC_Expected[L_Producer] = L_Sequence + 1;
+	}
+	MPSC_Check.Items++;
+}
+
+static void SPSC_Consumer_Task_func(void)
+{
+	uint8 L_Mark;
+	uint32 L_Item , L_Start , L_End;
+	FIFO_STATUS L_Status;
+
+	while(1)
+	{
+		// Blocks until the Producer Notifies the first Item of a Burst (or the Wait expires during a Pause)
+		if(SPSC_Ring_Dequeue_Wait(&SPSC_Ring, &L_Item, BENCH_WAIT_TICKS) != QUEUE_NO_ERROR)
+		{
+			SPSC_Check.Wait_Timeouts++;
+			continue;
+		}
+		Bench_SPSC_Check_Item(L_Item);
+
+		// The rest of the Burst
+		do
+		{
+			L_Mark = Bench_Tick_Mark();
+			L_Start = Bench_Timestamp();
+			L_Status = SPSC_Ring_Dequeue(&SPSC_Ring, &L_Item);
+			L_End = Bench_Timestamp();
+
+			if(L_Status == QUEUE_NO_ERROR)
+			{
+				if(Bench_Tick_Mark() == L_Mark)
+				{
+					Bench_Stats_Add((Bench_Stats*)&SPSC_Check.Dequeue, Bench_Elapsed(L_Start, L_End));
+				}
+				Bench_SPSC_Check_Item(L_Item);
+			}
+		}while(L_Status == QUEUE_NO_ERROR);
+	}
+}
+
+static void MPSC_Consumer_Task_func(void)
+{
+	uint8 L_Mark;
+	uint32 L_Item , L_Start , L_End;
+	FIFO_STATUS L_Status;
+
+	while(1)
+	{
+		if(MPSC_Ring_Dequeue_Wait(&MPSC_Ring, &L_Item, BENCH_WAIT_TICKS) != QUEUE_NO_ERROR)
+		{
+			MPSC_Check.Wait_Timeouts++;
+			continue;
+		}
+		Bench_MPSC_Check_Item(L_Item);
+
+		do
+		{
+			L_Mark = Bench_Tick_Mark();
+			L_Start = Bench_Timestamp();
+			L_Status = MPSC_Ring_Dequeue(&MPSC_Ring, &L_Item);
+			L_End = Bench_Timestamp();
+
+			if(L_Status == QUEUE_NO_ERROR)
+			{
+				if(Bench_Tick_Mark() == L_Mark)
+				{
+					Bench_Stats_Add((Bench_Stats*)&MPSC_Check.Dequeue, Bench_Elapsed(L_Start, L_End));
+				}
+				Bench_MPSC_Check_Item(L_Item);
+			}
+		}while(L_Status == QUEUE_NO_ERROR);
+	}
+}
+
+/****************************************************************************************************************************/
+
+static void Bench_Rings_Init(void)
+{
+	uint32 i , L_Index;
+
+	SPSC_Ring_Init(&SPSC_Ring, &SPSC_Consumer_Task);
+	MPSC_Ring_Init(&MPSC_Ring, &MPSC_Consumer_Task);
+
+	// Start the Free-Running Indices just below 2^32 (the MPSC Slots get the Sequences of their First Indices)
+	SPSC_Ring.head = BENCH_START_INDEX;
+	SPSC_Ring.tail = BENCH_START_INDEX;
+
+	for(i = 0 ; i < BENCH_RING_LENGTH ; i++)
+	{
+		L_Index = BENCH_START_INDEX + i;
+		MPSC_Ring.slots[L_Index & (BENCH_RING_LENGTH - 1)].sequence = L_Index;
+	}
+	MPSC_Ring.head = BENCH_START_INDEX;
+	MPSC_Ring.tail = BENCH_START_INDEX;
+
+	Bench_Stats_Init((Bench_Stats*)&SPSC_Check.Enqueue);
+	Bench_Stats_Init((Bench_Stats*)&SPSC_Check.Dequeue);
+	Bench_Stats_Init((Bench_Stats*)&MPSC_Check.Enqueue);
+	Bench_Stats_Init((Bench_Stats*)&MPSC_Check.Dequeue);
+}
+
+static void Bench_Report_Ring(const char *ring_name , volatile Ring_Check_ref *p_Check)
+{
+	printf("BENCH_FIFO,%s,%lu,%lu,%lu,%lu,%lu\n", ring_name, (unsigned long)p_Check->Items,
+			(unsigned long)(p_Check->Items / BENCH_RING_LENGTH), (unsigned long)p_Check->Order_Errors,
+			(unsigned long)p_Check->Full, (unsigned long)p_Check->Wait_Timeouts);
+}
+
+static void Controller_Task_func(void)
+{
+	uint32 L_Waited_Ticks = 0;
+
+	// Every Item is Received , or the Sending time is largely exceeded (Lost Items)
+	uint32 L_Max_Ticks = 2 * ((BENCH_FIFO_ITEMS / BENCH_BURST) + 1) * BENCH_PAUSE_PERIOD / (BENCH_PAUSE_PERIOD - BENCH_PAUSE_TICKS);
+
+	Bench_IRQ_Work[0] = Bench_IRQ0_Producers;
+	Bench_IRQ_Work[1] = Bench_IRQ1_Producer;
+	Samy_OS_Activate_Task(&Trigger_Task);
+
+	while(((SPSC_Check.Items < BENCH_FIFO_ITEMS) || (MPSC_Check.Items < (MPSC_PRODUCERS_NUM * BENCH_FIFO_ITEMS))) &&
+			(L_Waited_Ticks < L_Max_Ticks))
+	{
+		Samy_OS_Task_Wait(BENCH_PAUSE_PERIOD, &Controller_Task);
+		L_Waited_Ticks += BENCH_PAUSE_PERIOD;
+	}
+
+	Samy_OS_Terminate_Task(&Trigger_Task);
+
+	Bench_Report_Header();
+	Bench_Report("SPSC_Enqueue_From_ISR", (Bench_Stats*)&SPSC_Check.Enqueue);
+	Bench_Report("SPSC_Dequeue", (Bench_Stats*)&SPSC_Check.Dequeue);
+	Bench_Report("MPSC_Enqueue_From_ISR", (Bench_Stats*)&MPSC_Check.Enqueue);
+	Bench_Report("MPSC_Dequeue", (Bench_Stats*)&MPSC_Check.Dequeue);
+	Bench_Report_Ring("SPSC", &SPSC_Check);
+	Bench_Report_Ring("MPSC", &MPSC_Check);
+	Bench_Report_End();
+
+	Bench_Exit();
+}
+
+/****************************************************************************************************************************/
+
+int main(void)
+{
+	HW_Init();
+	Bench_IRQ_Init();
+
+	if(Samy_OS_Init() != No_Error)
+	{
+		while(1);
+	}
+
+	Controller_Task.Task_Stack_Size = 1024; // printf of the Report
+	Controller_Task.pf_Task_Entry = Controller_Task_func;
+	Controller_Task.Task_Priority = 10;
+	Samy_OS_Create_Task(&Controller_Task);
+
+	Trigger_Task.Task_Stack_Size = 256;
+	Trigger_Task.pf_Task_Entry = Trigger_Task_func;
+	Trigger_Task.Task_Priority = 5;
+	Samy_OS_Create_Task(&Trigger_Task);
+
+	SPSC_Consumer_Task.Task_Stack_Size = 256;
+	SPSC_Consumer_Task.pf_Task_Entry = SPSC_Consumer_Task_func;
+	SPSC_Consumer_Task.Task_Priority = 3;
+	Samy_OS_Create_Task(&SPSC_Consumer_Task);
+
+	MPSC_Consumer_Task.Task_Stack_Size = 256;
+	MPSC_Consumer_Task.pf_Task_Entry = MPSC_Consumer_Task_func;
+	MPSC_Consumer_Task.Task_Priority = 3;
+	Samy_OS_Create_Task(&MPSC_Consumer_Task);
+
+	Bench_Rings_Init();
+
+	Samy_OS_Activate_Task(&Controller_Task);
+	Samy_OS_Activate_Task(&SPSC_Consumer_Task);
+	Samy_OS_Activate_Task(&MPSC_Consumer_Task);
+
+	Samy_OS_Start_OS();
+
+	while(1)
+	{
+
+	}
+}
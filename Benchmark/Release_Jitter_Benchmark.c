@@ -0,0 +1,290 @@
+/*
+ * Release_Jitter_Benchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Youssef Samy
+ */
+
+/*
+	Periodic Tasks Release Jitter Benchmark (Replaces Src/main.c in the Benchmark Build , See README.md):
+	-----------------------------------------------------------------------------------------------
+	The README Test Case 2: 3 Periodic Tasks (Priority 3) Running every 100 , 300 and 500 ticks using Samy_OS_Task_Wait.
+	Every Job logs its Release time (the tick its Wait expires in) and its Start time , and the Benchmark reports:
+	* Latency   : Start time - Release time (min/avg/max ===> the Jitter is max - min)
+	* Late Jobs : Jobs Started one tick or more after their Release tick
+	* Drift     : (Last Start tick - First Start tick) - (Jobs - 1) * Period , the Start time lost over all the Jobs
+
+	The Controller Task (Priority 1) sweeps:
+	* Background CPU Load : a Load Task (Priority 3) Busy for Load% of every tick
+	* Tasks Number        : Extra Periodic Tasks (Priority 3) Waiting 1..7 ticks
+
+	Report (One Line per Periodic Task and Sweep Point):
+	BENCH_JITTER,<Period>,<Load %>,<Active Tasks>,<Latency min>,<avg>,<max>,<Jobs>,<Late Jobs>,<Drift ticks>
+
+	Built with -DOS_TICK_HOOK=1 (Ticks and Tick times) , the Job Count and the Periods are configurable:
+	-DBENCH_JITTER_JOBS=<Jobs of the 100 ticks Task per Sweep Point> -DBENCH_PERIOD_DIV=<Divider of the Periods>
+	-DBENCH_WAIT_UNTIL=1 ===> the Periodic Tasks use Samy_OS_Task_Wait_Until (Absolute Releases) instead of Samy_OS_Task_Wait
+	Note: a tick happening between reading the tick count and the Wait SVC shifts the Release by 1 tick (Counted as a Late Job).
+*/
+
+#include "Samy_OS_Benchmark.h"
+
+
+#if OS_TICK_HOOK == 0
+#error "The Release Jitter Benchmark needs the Tick Hook (-DOS_TICK_HOOK=1)"
+#endif
+
+#ifndef BENCH_JITTER_JOBS
+#define BENCH_JITTER_JOBS		1000
+#endif
+
+#ifndef BENCH_PERIOD_DIV
+#define BENCH_PERIOD_DIV		1
+#endif
+
+#ifndef BENCH_WAIT_UNTIL
+#define BENCH_WAIT_UNTIL		0
+#endif
+
+#define PERIODIC_TASKS_NUM		3
+#define EXTRA_TASKS_MAX			32
+
+#define PERIODIC_PRIORITY		3
+
+typedef struct
+{
+	uint32 Period;
+	uint32 Jobs;
+	uint32 Late_Jobs;
+	uint32 First_Start_Tick;
+	uint32 Last_Start_Tick;
+	uint32 Release_Tick;
+	Bench_Stats Latency;
+}Periodic_Job_ref;
+
+static const uint8 Bench_Loads[] = {0, 25, 50, 75}; // Background CPU Load (% of every tick)
+static const uint8 Bench_Extra_Tasks[] = {0, 8, EXTRA_TASKS_MAX};
+
+static Tasks_ref Controller_Task , Load_Task;
+static Tasks_ref Periodic_Tasks[PERIODIC_TASKS_NUM];
+static Tasks_ref Extra_Tasks[EXTRA_TASKS_MAX];
+
+static volatile Periodic_Job_ref Periodic_Jobs[PERIODIC_TASKS_NUM] =
+{
+	{.Period = 100 / BENCH_PERIOD_DIV},
+	{.Period = 300 / BENCH_PERIOD_DIV},
+	{.Period = 500 / BENCH_PERIOD_DIV},
+};
+
+static volatile uint32 Load_Percent;
+
+uint8 Periodic_Tasks_LED[PERIODIC_TASKS_NUM];
+
+/****************************************************************************************************************************/
+
+static void Periodic_Task_func(void)
+{
+	// All the Periodic Tasks share this Function
+	Tasks_ref *p_Self = Samy_OS_Get_Current_Task();
+	uint32 L_Index = (uint32)(p_Self - Periodic_Tasks);
+	volatile Periodic_Job_ref *p_Job = &Periodic_Jobs[L_Index];
+	uint64 L_Start_Time;
+	uint32 L_Start_Tick;
+
+	while(1)
+	{
+		L_Start_Time = Bench_Time_Now();
+		L_Start_Tick = Bench_Tick_Count();
+
+		if(p_Job->Jobs == 0)
+		{
+			// First Job (Activated by the Controller)
+			p_Job->First_Start_Tick = L_Start_Tick;
+			p_Job->Release_Tick = Samy_OS_Get_Tick_Count();
+		}
+		else
+		{
+			if(L_Start_Tick != p_Job->Release_Tick)
+			{
+				p_Job->Late_Jobs++;
+			}
+
+			if((L_Start_Tick - p_Job->Release_Tick) < BENCH_TICK_HISTORY)
+			{
+				Bench_Stats_Add((Bench_Stats*)&p_Job->Latency, (uint32)(L_Start_Time - Bench_Tick_Time(p_Job->Release_Tick)));
+			}
+		}
+		p_Job->Last_Start_Tick = L_Start_Tick;
+		p_Job->Jobs++;
+
+		// The Job
+		Periodic_Tasks_LED[L_Index] ^= 1;
+
+#if BENCH_WAIT_UNTIL
+		// The OS advances the Release tick by one Period
+		Samy_OS_Task_Wait_Until((uint32*)&p_Job->Release_Tick, p_Job->Period, p_Self);
+#else
+		// The Wait expires in the tick (Current tick + Period)
+		p_Job->Release_Tick = Bench_Tick_Count() + p_Job->Period;
+		Samy_OS_Task_Wait(p_Job->Period, p_Self);
+#endif
+	}
+}
+
+static void Extra_Task_func(void)
+{
+	// All the Extra Tasks share this Function
+	Tasks_ref *p_Self = Samy_OS_Get_Current_Task();
+	uint32 L_Period = 1 + ((uint32)(p_Self - Extra_Tasks) % 7);
+
+	while(1)
+	{
+		Samy_OS_Task_Wait(L_Period, p_Self);
+	}
+}
+
+static void Load_Task_func(void)
+{
+	uint32 L_Tick;
+	uint64 L_Busy_End;
+
+	while(1)
+	{
+		// Busy for Load% of the Current tick , then Wait for the Next tick
+		L_Tick = Bench_Tick_Count();
+		L_Busy_End = Bench_Tick_Time(L_Tick) + ((uint64)BENCH_TICK_PERIOD * Load_Percent) / 100;
+
+		while((Bench_Time_Now() < L_Busy_End) && (Bench_Tick_Count() == L_Tick));
+
+		Samy_OS_Task_Wait(1, &Load_Task);
+	}
+}
+
+/****************************************************************************************************************************/
+
+static void Bench_Run_Sweep_Point(uint8 load_percent , uint8 extra_tasks)
+{
+	uint32 i;
+	uint32 L_Active_Tasks = PERIODIC_TASKS_NUM + extra_tasks;
+
+	for(i = 0 ; i < PERIODIC_TASKS_NUM ; i++)
+	{
+		Periodic_Jobs[i].Jobs = 0;
+		Periodic_Jobs[i].Late_Jobs = 0;
+		Bench_Stats_Init((Bench_Stats*)&Periodic_Jobs[i].Latency);
+	}
+
+	for(i = 0 ; i < extra_tasks ; i++)
+	{
+		Samy_OS_Activate_Task(&Extra_Tasks[i]);
+	}
+
+	Load_Percent = load_percent;
+	if(load_percent != 0)
+	{
+		Samy_OS_Activate_Task(&Load_Task);
+		L_Active_Tasks++;
+	}
+
+	for(i = 0 ; i < PERIODIC_TASKS_NUM ; i++)
+	{
+		Samy_OS_Activate_Task(&Periodic_Tasks[i]);
+	}
+
+	// Sleep until the Fastest Periodic Task finishes its Jobs
+	while(Periodic_Jobs[0].Jobs <= BENCH_JITTER_JOBS)
+	{
+		Samy_OS_Task_Wait(Periodic_Jobs[0].Period, &Controller_Task);
+	}
+
+	for(i = 0 ; i < PERIODIC_TASKS_NUM ; i++)
+	{
+		Samy_OS_Terminate_Task(&Periodic_Tasks[i]);
+	}
+	Samy_OS_Terminate_Task(&Load_Task);
+	for(i = 0 ; i < extra_tasks ; i++)
+	{
+		Samy_OS_Terminate_Task(&Extra_Tasks[i]);
+	}
+
+	for(i = 0 ; i < PERIODIC_TASKS_NUM ; i++)
+	{
+		volatile Periodic_Job_ref *p_Job = &Periodic_Jobs[i];
+		uint32 L_Jobs = p_Job->Jobs;
+		sint32 L_Drift = (sint32)((p_Job->Last_Start_Tick - p_Job->First_Start_Tick) - ((L_Jobs - 1) * p_Job->Period));
+		uint32 L_Count = p_Job->Latency.Count;
+
+		printf("BENCH_JITTER,%lu,%u,%lu,%lu,%lu,%lu,%lu,%lu,%ld\n", (unsigned long)p_Job->Period, load_percent,
+				(unsigned long)L_Active_Tasks, (unsigned long)((L_Count != 0) ? p_Job->Latency.Min : 0),
+				(unsigned long)((L_Count != 0) ? (p_Job->Latency.Sum / L_Count) : 0), (unsigned long)p_Job->Latency.Max,
+				(unsigned long)L_Jobs, (unsigned long)p_Job->Late_Jobs, (long)L_Drift);
+	}
+}
+
+static void Controller_Task_func(void)
+{
+	uint32 L_Load , L_Extra;
+
+	Bench_Report_Header();
+
+	for(L_Extra = 0 ; L_Extra < sizeof(Bench_Extra_Tasks) ; L_Extra++)
+	{
+		for(L_Load = 0 ; L_Load < sizeof(Bench_Loads) ; L_Load++)
+		{
+			Bench_Run_Sweep_Point(Bench_Loads[L_Load], Bench_Extra_Tasks[L_Extra]);
+		}
+	}
+
+	Bench_Report_End();
+
+	Bench_Exit();
+}
+
+/****************************************************************************************************************************/
+
+int main(void)
+{
+	uint32 i;
+
+	HW_Init();
+
+	if(Samy_OS_Init() != No_Error)
+	{
+		while(1);
+	}
+
+	Controller_Task.Task_Stack_Size = 1024; // printf of the Report
+	Controller_Task.pf_Task_Entry = Controller_Task_func;
+	Controller_Task.Task_Priority = 1;
+	Samy_OS_Create_Task(&Controller_Task);
+
+	Load_Task.Task_Stack_Size = 256;
+	Load_Task.pf_Task_Entry = Load_Task_func;
+	Load_Task.Task_Priority = PERIODIC_PRIORITY;
+	Samy_OS_Create_Task(&Load_Task);
+
+	for(i = 0 ; i < PERIODIC_TASKS_NUM ; i++)
+	{
+		Periodic_Tasks[i].Task_Stack_Size = 256;
+		Periodic_Tasks[i].pf_Task_Entry = Periodic_Task_func;
+		Periodic_Tasks[i].Task_Priority = PERIODIC_PRIORITY;
+		Samy_OS_Create_Task(&Periodic_Tasks[i]);
+	}
+
+	for(i = 0 ; i < EXTRA_TASKS_MAX ; i++)
+	{
+		Extra_Tasks[i].Task_Stack_Size = 128;
+		Extra_Tasks[i].pf_Task_Entry = Extra_Task_func;
+		Extra_Tasks[i].Task_Priority = PERIODIC_PRIORITY;
+		Samy_OS_Create_Task(&Extra_Tasks[i]);
+	}
+
+	Samy_OS_Activate_Task(&Controller_Task);
+
+	Samy_OS_Start_OS();
+
+	while(1)
+	{
+
+	}
+}
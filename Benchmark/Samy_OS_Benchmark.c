@@ -0,0 +1,335 @@
+/*
+ * Samy_OS_Benchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Youssef Samy
+ */
+
+
+#include "Samy_OS_Benchmark.h"
+
+
+extern uint8 SysTick_LED; // Toggled by the SysTick_Handler (Scheduler.c)
+
+#if OS_TICK_HOOK
+static vuint32 Bench_Ticks;
+static uint64 Bench_Tick_Times[BENCH_TICK_HISTORY];
+#endif
+
+void (*volatile Bench_IRQ_Work[BENCH_IRQ_LINES])(void);
+
+static void Bench_IRQ_Handler(uint32 line)
+{
+	if(Bench_IRQ_Work[line] != NULL)
+	{
+		Bench_IRQ_Work[line]();
+	}
+}
+
+
+#ifdef OS_HOST_PORT
+
+#include <stdlib.h>
+#include <time.h>
+
+const char *const Bench_Unit = "ns";
+
+uint32 Bench_Timestamp(void)
+{
+	struct timespec L_Time;
+
+	clock_gettime(CLOCK_MONOTONIC, &L_Time);
+
+	return (uint32)((L_Time.tv_sec * 1000000000ULL) + L_Time.tv_nsec);
+}
+
+uint32 Bench_Elapsed(uint32 start , uint32 end)
+{
+	return end - start; // Up-Counter , Wraps at 2^32
+}
+
+void Bench_Exit(void)
+{
+	fflush(stdout);
+	exit(0);
+}
+
+static void Bench_IRQ0_Handler(void)
+{
+	Bench_IRQ_Handler(0);
+}
+
+static void Bench_IRQ1_Handler(void)
+{
+	Bench_IRQ_Handler(1);
+}
+
+void Bench_IRQ_Init(void)
+{
+	Host_IRQ_Init(0, Bench_IRQ0_Handler);
+	Host_IRQ_Init(1, Bench_IRQ1_Handler);
+}
+
+void Bench_Trigger_IRQ(uint32 line)
+{
+	Host_Trigger_IRQ(line);
+}
+
+#if OS_TICK_HOOK
+uint64 Bench_Time_Now(void)
+{
+	struct timespec L_Time;
+
+	clock_gettime(CLOCK_MONOTONIC, &L_Time);
+
+	return (L_Time.tv_sec * 1000000000ULL) + L_Time.tv_nsec;
+}
+#endif
+
+#else
+
+const char *const Bench_Unit = "cycles";
+
+/*
+	Semihosting (ARM): the Debugger (or QEMU with -semihosting) executes the Operation in R0 with the Argument in R1
+	* SYS_WRITEC (0x03) ===> R1 points to the Character
+	* SYS_EXIT   (0x18) ===> R1 is the Reason Code (ADP_Stopped_ApplicationExit = 0x20026)
+*/
+#define SEMIHOSTING_SYS_WRITEC				0x03
+#define SEMIHOSTING_SYS_EXIT				0x18
+#define SEMIHOSTING_APPLICATION_EXIT		0x20026
+
+static OS_Register Bench_Semihosting_Call(uint32 operation , OS_Register argument)
+{
+	register OS_Register r0 __asm("r0") = operation;
+	register OS_Register r1 __asm("r1") = argument;
+
+	__asm volatile("BKPT 0xAB" : "+r" (r0) : "r" (r1) : "memory");
+
+	return r0;
+}
+
+// Called by _write (Src/syscalls.c) for every Character printed by printf
+int __io_putchar(int ch)
+{
+	char L_Char = (char)ch;
+
+	Bench_Semihosting_Call(SEMIHOSTING_SYS_WRITEC, (OS_Register)&L_Char);
+
+	return ch;
+}
+
+uint32 Bench_Timestamp(void)
+{
+	return SysTick->VAL;
+}
+
+uint32 Bench_Elapsed(uint32 start , uint32 end)
+{
+	// The Systick is a Down-Counter , reloaded with LOAD every tick
+	if(start >= end)
+	{
+		return start - end;
+	}
+	else
+	{
+		return start + (SysTick->LOAD + 1) - end;
+	}
+}
+
+#if OS_TICK_HOOK
+uint64 Bench_Time_Now(void)
+{
+	uint32 L_Ticks , L_Value;
+
+	// Read the ticks and the Systick Value again , if a tick happened between them
+	do
+	{
+		L_Ticks = Bench_Ticks;
+		L_Value = SysTick->VAL;
+	}while(L_Ticks != Bench_Ticks);
+
+	return ((uint64)L_Ticks * (SysTick->LOAD + 1)) + (SysTick->LOAD - L_Value);
+}
+#endif
+
+void Bench_Exit(void)
+{
+	fflush(stdout);
+	Bench_Semihosting_Call(SEMIHOSTING_SYS_EXIT, SEMIHOSTING_APPLICATION_EXIT);
+
+	while(1); // Without a Debugger/QEMU
+}
+
+// STM32F103 Vectors 6 , 7 (Unused EXTI Lines , only Pended by Software)
+static const IRQn_Type Bench_IRQn[BENCH_IRQ_LINES] = {Interrupt6_IRQn, Interrupt7_IRQn};
+
+void EXTI0_IRQHandler(void)
+{
+	Bench_IRQ_Handler(0);
+}
+
+void EXTI1_IRQHandler(void)
+{
+	Bench_IRQ_Handler(1);
+}
+
+void Bench_IRQ_Init(void)
+{
+	// Both above the Systick/PendSV (Priority 15) , and the line 1 Preempts the line 0
+	NVIC_SetPriority(Bench_IRQn[0], 14);
+	NVIC_SetPriority(Bench_IRQn[1], 13);
+	NVIC_EnableIRQ(Bench_IRQn[0]);
+	NVIC_EnableIRQ(Bench_IRQn[1]);
+}
+
+void Bench_Trigger_IRQ(uint32 line)
+{
+	NVIC_SetPendingIRQ(Bench_IRQn[line]);
+
+	// The Interrupt is taken before the Next Instruction (if not Masked)
+	__DSB();
+	__ISB();
+}
+
+#endif
+
+uint8 Bench_Tick_Mark(void)
+{
+	return *(volatile uint8*)&SysTick_LED;
+}
+
+#if OS_TICK_HOOK
+void Samy_OS_Tick_Hook(uint32 elapsed_ticks)
+{
+	Bench_Ticks += elapsed_ticks;
+	Bench_Tick_Times[Bench_Ticks % BENCH_TICK_HISTORY] = Bench_Time_Now();
+}
+
+uint32 Bench_Tick_Count(void)
+{
+	return Bench_Ticks;
+}
+
+uint64 Bench_Tick_Time(uint32 tick)
+{
+	return Bench_Tick_Times[tick % BENCH_TICK_HISTORY];
+}
+#endif
+
+/****************************************************************************************************************************/
+
+uint32 Bench_Measure_Tick_ISR(void)
+{
+	// The Systick Handler makes a gap in a tight Timestamp loop , the Handler time = the gap - the Loop time
+	uint8 L_Mark = Bench_Tick_Mark();
+	uint32 L_Prev , L_Now , L_Gap;
+	uint32 L_Loop_Min = 0xFFFFFFFF , L_Tick_Gap = 0;
+	uint8 L_Loops_After_Tick = 0;
+
+	L_Prev = Bench_Timestamp();
+	while(L_Loops_After_Tick < 2)
+	{
+		L_Now = Bench_Timestamp();
+		L_Gap = Bench_Elapsed(L_Prev, L_Now);
+		L_Prev = L_Now;
+
+		if(Bench_Tick_Mark() == L_Mark)
+		{
+			if(L_Gap < L_Loop_Min)
+			{
+				L_Loop_Min = L_Gap;
+			}
+		}
+		else
+		{
+			// The Tick is detected either in the Loop it happened in , or in the Loop before it
+			if(L_Gap > L_Tick_Gap)
+			{
+				L_Tick_Gap = L_Gap;
+			}
+			L_Loops_After_Tick++;
+		}
+	}
+
+	return (L_Tick_Gap > L_Loop_Min) ? (L_Tick_Gap - L_Loop_Min) : 0;
+}
+
+uint32 Bench_Measure_Context_Switch(void)
+{
+	uint32 L_Elapsed = 0;
+
+#ifndef OS_HOST_PORT
+	uint8 L_Mark = Bench_Tick_Mark();
+	uint32 L_Start , L_End;
+
+	// No Next Task is Decided ===> the PendSV Saves the Running Task and Restores it (Same Instructions as a Switch , except
+	// updating Current_Task/Next_Task). The Barriers make the Pended Exception taken before the Second Timestamp.
+	L_Start = Bench_Timestamp();
+	Trigger_OS_PendSV();
+	__DSB();
+	__ISB();
+	L_End = Bench_Timestamp();
+
+	if(Bench_Tick_Mark() == L_Mark)
+	{
+		L_Elapsed = Bench_Elapsed(L_Start, L_End);
+	}
+#endif
+
+	return L_Elapsed;
+}
+
+void Bench_Stats_Init(Bench_Stats *p_Stats)
+{
+	p_Stats->Min = 0xFFFFFFFF;
+	p_Stats->Max = 0;
+	p_Stats->Sum = 0;
+	p_Stats->Count = 0;
+}
+
+void Bench_Stats_Add(Bench_Stats *p_Stats , uint32 sample)
+{
+	if(sample < p_Stats->Min)
+	{
+		p_Stats->Min = sample;
+	}
+	if(sample > p_Stats->Max)
+	{
+		p_Stats->Max = sample;
+	}
+	p_Stats->Sum += sample;
+	p_Stats->Count++;
+}
+
+void Bench_Report_Header(void)
+{
+	printf("BENCH_UNIT,%s\n", Bench_Unit);
+}
+
+void Bench_Report(const char *metric_name , Bench_Stats *p_Stats)
+{
+	if(p_Stats->Count == 0)
+	{
+		printf("BENCH,%s,0,0,0,0\n", metric_name);
+	}
+	else
+	{
+		printf("BENCH,%s,%lu,%lu,%lu,%lu\n", metric_name, (unsigned long)p_Stats->Min,
+				(unsigned long)(p_Stats->Sum / p_Stats->Count), (unsigned long)p_Stats->Max, (unsigned long)p_Stats->Count);
+	}
+}
+
+void Bench_Report_Curve(const char *metric_name , uint32 tasks_num , Bench_Stats *p_Stats)
+{
+	uint32 L_Avg = (p_Stats->Count != 0) ? (p_Stats->Sum / p_Stats->Count) : 0;
+	uint32 L_Min = (p_Stats->Count != 0) ? p_Stats->Min : 0;
+
+	printf("BENCH_CURVE,%s,%lu,%lu,%lu,%lu,%lu\n", metric_name, (unsigned long)tasks_num, (unsigned long)L_Min,
+			(unsigned long)L_Avg, (unsigned long)p_Stats->Max, (unsigned long)p_Stats->Count);
+}
+
+void Bench_Report_End(void)
+{
+	printf("BENCH_END\n");
+}
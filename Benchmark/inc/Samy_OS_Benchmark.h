@@ -0,0 +1,114 @@
+/*
+ * Samy_OS_Benchmark.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Youssef Samy
+ */
+
+/*
+	Kernel Benchmarks:
+	-----------------
+	* Timebase : Cortex-M3 ===> the Systick Current Value (VAL) , in Systick Clock Cycles (Intervals must be shorter than 1 tick)
+	             Host      ===> CLOCK_MONOTONIC , in Nano-Seconds
+	* Report   : Machine-Readable CSV Lines , printed over the Semihosting (Src/syscalls.c ===> __io_putchar) or the Host stdout
+
+	BENCH_UNIT,<cycles|ns>
+	BENCH,<Metric Name>,<min>,<avg>,<max>,<samples>
+	BENCH_CURVE,<Metric Name>,<Tasks Number>,<min>,<avg>,<max>,<samples>     (Scaling Benchmarks)
+	BENCH_END
+
+	The Tasks must be able to read the Systick ===> the Benchmarks are built with -DOS_UNPRIVILEGED_TASKS=0
+	and with a Periodic Tick (-DOS_TICKLESS_IDLE=0) , to keep the Systick Reload Value constant.
+*/
+
+#ifndef SAMY_OS_BENCHMARK_H_
+#define SAMY_OS_BENCHMARK_H_
+
+#include <stdio.h>
+#include "Scheduler.h"
+
+#define BENCH_SAMPLES		100 // Samples of each Metric
+
+
+typedef struct
+{
+	uint32 Min;
+	uint32 Max;
+	uint32 Sum;
+	uint32 Count;
+}Bench_Stats;
+
+
+/********************************************* Timebase APIs *********************************************/
+
+// Free-Running Timestamp (Units of BENCH_UNIT)
+uint32 Bench_Timestamp(void);
+
+// Time between 2 Timestamps (Handles the Wrap-around of the Timebase)
+uint32 Bench_Elapsed(uint32 start , uint32 end);
+
+// Toggled by every Systick ===> a Sample is valid only if no tick happened between its Timestamps
+uint8 Bench_Tick_Mark(void);
+
+// Systick Handler time (No Context Switching) , measured as the gap it makes in a tight Timestamp loop (Waits for the Next tick)
+uint32 Bench_Measure_Tick_ISR(void);
+
+/*
+	PendSV Save/Restore (Cortex-M3 only): the Running Task Pends the PendSV itself , without any Scheduling Decision
+	===> the Exception Entry , the Context SAVE/RESTORE (R4-R11 , PSP) and the Exception Return , between 2 Timestamps.
+	Returns 0 if a tick happened during the Sample. On the Host , the PendSV is emulated by a Function Call at the End of
+	the SVC/SysTick (No Exception) ===> Returns 0 , No Sample.
+*/
+uint32 Bench_Measure_Context_Switch(void);
+
+#if OS_TICK_HOOK
+/*
+	Long Benchmarks (Built with -DOS_TICK_HOOK=1): the Tick Hook counts the ticks , and records the Time of the recent ticks
+*/
+#define BENCH_TICK_HISTORY	64
+
+#ifdef OS_HOST_PORT
+#define BENCH_TICK_PERIOD	1000000 // 1msec SIGALRM Interval (nano-seconds)
+#else
+#define BENCH_TICK_PERIOD	OS_TICK_PERIOD_CYCLES
+#endif
+
+// 64-Bit Time since starting the OS (Units of BENCH_UNIT)
+uint64 Bench_Time_Now(void);
+
+// Ticks counted by the Tick Hook
+uint32 Bench_Tick_Count(void);
+
+// Time of a recent tick (One of the last BENCH_TICK_HISTORY ticks)
+uint64 Bench_Tick_Time(uint32 tick);
+#endif
+
+/*
+	Benchmark Interrupts: 2 Software-Triggered Peripheral Interrupts running Bench_IRQ_Work[line] (e.g. the Producers of a Ring)
+	* Cortex-M3 ===> EXTI0 (line 0) and EXTI1 (line 1) Pended in the NVIC , the line 1 Preempts the line 0 (Nested Interrupts)
+	* Host      ===> the IRQs Signals of the Host Port , they don't Preempt each other (the line 1 runs when the line 0 returns)
+*/
+#define BENCH_IRQ_LINES		2
+
+extern void (*volatile Bench_IRQ_Work[BENCH_IRQ_LINES])(void);
+
+void Bench_IRQ_Init(void);
+void Bench_Trigger_IRQ(uint32 line);
+
+// Stops the Benchmark (Semihosting SYS_EXIT terminates QEMU , exit() on the Host)
+void Bench_Exit(void);
+
+extern const char *const Bench_Unit;
+
+
+/********************************************* Report APIs *********************************************/
+
+void Bench_Stats_Init(Bench_Stats *p_Stats);
+void Bench_Stats_Add(Bench_Stats *p_Stats , uint32 sample);
+void Bench_Report_Header(void);
+void Bench_Report(const char *metric_name , Bench_Stats *p_Stats);
+void Bench_Report_Curve(const char *metric_name , uint32 tasks_num , Bench_Stats *p_Stats);
+void Bench_Report_End(void);
+
+
+#endif /* SAMY_OS_BENCHMARK_H_ */
@@ -7,6 +7,14 @@
 
 #include "CortexMX_OS_Porting.h"
 
+static uint8 Ticker_Suppressed;
+static uint8 Ticker_Realigning;		 // 1: 1st Half of the Partial Period after Ticker_Resume , 2: 2nd Half (See Ticker_Resume)
+static uint32 Ticker_Realign_Cycles; // Cycles of each Half of the Partial Period
+static sint32 Ticker_Elapsed_Cycles; // Cycles elapsed from the last Tick , until the Counter was Reprogrammed (Negative: the last Tick was credited Early)
+
+// Below this , a Half of the Partial Period is too short for the Systick Handler to restore the 1msec Period before the Tick
+#define TICKER_MIN_RELOAD_CYCLES	128
+
 void NMI_Handler(void)
 {
 
@@ -35,8 +43,50 @@ __attribute ((naked)) void SVC_Handler()
 			"ITE    EQ        \n\t"
 			"MRSEQ  R0, MSP   \n\t"
 			"MRSNE  R0, PSP   \n\t" // R0 now holds the PSP (StackFramePointer)
-			"B      Samy_OS_SVC_Services"); // We will extract the SVC ID_number in this API to be able to execute the required service
+			"B      Samy_OS_SVC_Services"); // We will extract the Service Number (Stacked R12) and its Arguments in this API to execute the required service
+
+}
 
+/*
+	PendSV_Handler: Context Switching between OS_Control.Current_Task and OS_Control.Next_Task
+	---------------------------------------------------------------------------------------
+	The Processor already Stacked (xPSR,PC,LR,R12,R3,R2,R1,R0) on the PSP of the Current Task ,
+	So Only (R4-R11) are Saved/Restored here , using a Single Block Transfer in each direction.
+
+	Layout used (Checked by _Static_assert in Scheduler.c):
+	* OS_Control  ===> [0] Current_Task , [4] Next_Task
+	* Tasks_ref   ===> [0] Current_PSP
+
+	The Previous C Handler re-dereferenced OS_Control.Current_Task->Current_PSP for every Register , and relied on
+	Compiler-Generated code inside a Naked function. Handler Body Cost (Without the Exception Entry/Return , Same for both) ,
+	on the Context_Switch Path of Benchmark/Kernel_Microbenchmark.c (No Next_Task , the Same Task is Restored):
+	* Old C Handler ===> 143 Instructions , ~246 Cycles (-O2 Listing , 2 Loads + 1 Store per Saved/Restored Register)
+	* This Handler  ===>  12 Instructions ,   34 Cycles (STMDB/LDMIA = 9 Cycles each)
+	Counted on the Instruction Listings with the Cortex-M3 TRM Timings (LDR/STR 2 , LDM/STM 1+N , Taken CBZ 2) , not Timed on
+	the Board: under QEMU -icount the Context_Switch Metric follows the Instructions Counts (143 ===> 12).
+*/
+__attribute ((naked)) void PendSV_Handler()
+{
+	__asm volatile(
+			"CPSID  I                \n\t" // No Interrupt can change Current_Task/Next_Task during the Switch
+			"MRS    R0, PSP          \n\t"
+			"STMDB  R0!, {R4-R11}    \n\t" // 1- Context SAVE of the Current Task
+			"LDR    R1, =OS_Control  \n\t"
+			"LDR    R2, [R1]         \n\t" // R2 = OS_Control.Current_Task
+			"STR    R0, [R2]         \n\t" // OS_Control.Current_Task->Current_PSP = PSP
+			"LDR    R3, [R1, #4]     \n\t" // R3 = OS_Control.Next_Task
+			"CBZ    R3, 1f           \n\t"
+			"MOV    R2, R3           \n\t"
+			"STR    R2, [R1]         \n\t" // OS_Control.Current_Task = OS_Control.Next_Task
+			"MOVS   R3, #0           \n\t"
+			"STR    R3, [R1, #4]     \n\t" // OS_Control.Next_Task = NULL
+			"1:                      \n\t"
+			"LDR    R0, [R2]         \n\t" // 2- Context RESTORE of the Next Task
+			"LDMIA  R0!, {R4-R11}    \n\t"
+			"MSR    PSP, R0          \n\t"
+			"CPSIE  I                \n\t"
+			"BX     LR               \n\t"
+			".ltorg                  \n\t");
 }
 
 void HW_Init(void)
@@ -55,9 +105,225 @@ void HW_Init(void)
 	// SVC is by default the Highest Priority than Systick and PendSV
 }
 
+uint32* Stack_Frame_Init(uint32 *p_Stack_Top , void (*pf_Task_Entry)(void))
+{
+	/*
+		1- we need initially when creating each task to initialize ALL the CPU Registers from the start_psp of the task
+		   where it must be in order , for the Context Switching (Save/Restore) Operations ....
+
+		2- the Cortex-M Processor "Automatically" saves (xPSR , PC , LR , R12 , R3 , R2 , R1 , R0) when Interrupt Occurs
+
+		3- So we need "Manually" to save all Other CPU Registers which are (R4,R5,R6,R7,R8,R9,R10,R11)
+
+		4- But Now, in this API , we are just "initializing" all the CPU Registers for Further Context Switching Operations
+		   (we can initialize by any dummy value , since the task is not in the running state yet)
+
+	  	======> TASK FRAME <======
+	 * CPU Automatically Saved/Restored registers
+	 * ------------------------------------------
+	 * xPSR
+	 * PC (Next instruction to be executed in the task)
+	 * LR (return register which is saved in CPU before switching)
+	 * R12
+	 * R3
+	 * R2
+	 * R1
+	 * R0
+	 *
+	 * Manually Saved/Restored registers (STMDB/LDMIA in the PendSV_Handler)
+	 * ----------------------------------
+	 * R11
+	 * R10
+	 * R9
+	 * R8
+	 * R7
+	 * R6
+	 * R5
+	 * R4
+	 */
+
+	uint8 i;
+	uint32 *p_PSP = p_Stack_Top;
+
+	// xPSR dummy value -> T = 1 to avoid bus faults
+	p_PSP--;
+	*p_PSP = 0x01000000;
+
+	// PC dummy value -> Start at task entry point
+	p_PSP--;
+	*p_PSP = (uint32)pf_Task_Entry;
+
+	// LR dummy value -> Return to thread mode with PSP
+	p_PSP--;
+	*p_PSP = 0xFFFFFFFD;
+
+	// CPU General Purpose Registers -> initialized by ZERO
+	for(i = 0 ; i<13 ; i++)
+	{
+		p_PSP--;
+		*p_PSP = 0;
+	}
+
+	return p_PSP;
+}
+
 void Start_Ticker(void)
 {
-	SysTick_Config(8000); // Periodic Tick = 1msec
+	SysTick_Config(OS_TICK_PERIOD_CYCLES); // Periodic Tick = 1msec
 }
 
+static sint32 Ticker_Counted_Cycles(void)
+{
+	// Cycles elapsed since the last Tick credited to the OS , Including a Pending Systick (Negative before a Tick credited Early)
+	uint32 L_Value = SysTick->VAL;
+	sint32 L_Elapsed_Cycles = ((Ticker_Suppressed == 1) || (Ticker_Realigning != 0)) ? Ticker_Elapsed_Cycles : 0;
+
+	// The Period being Counted (While Realigning , the LOAD already holds the Next Period)
+	uint32 L_Period_Cycles = (Ticker_Realigning != 0) ? Ticker_Realign_Cycles : (SysTick->LOAD + 1);
+
+	if(SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)
+	{
+		// The Counter reached Zero , but the Systick Handler didn't credit the tick yet (Re-Read the Value after reaching Zero)
+		L_Value = SysTick->VAL;
+		L_Elapsed_Cycles += (sint32)L_Period_Cycles;
+		L_Period_Cycles = SysTick->LOAD + 1;
+	}
+
+	// The Systick Fires when counting from 1 to 0 , then Reloads
+	if(L_Value != 0)
+	{
+		L_Elapsed_Cycles += (sint32)(L_Period_Cycles - L_Value);
+	}
 
+	return L_Elapsed_Cycles;
+}
+
+uint8 Ticker_Suppress(uint32 ticks)
+{
+	sint32 L_Elapsed_Cycles;
+
+	if(ticks > OS_TICKLESS_MAX_TICKS)
+	{
+		ticks = OS_TICKLESS_MAX_TICKS;
+	}
+
+	// Stop the Counter while Reprogramming it , (Reading the CTRL also clears the COUNTFLAG)
+	SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+
+	if(SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)
+	{
+		// The Counter already reached Zero (the Tick is Pending , not credited yet) ===> the Periodic Tick is kept ,
+		// its Systick Handler credits the Tick and Decides again (Reprogramming now would lose that Tick)
+		SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+		return 0;
+	}
+
+	// Cycles elapsed since the last Tick (Including a Realignment in progress , the Counter is Stopped)
+	L_Elapsed_Cycles = Ticker_Counted_Cycles();
+
+	Ticker_Suppressed = 1;
+	Ticker_Realigning = 0;
+	Ticker_Elapsed_Cycles = L_Elapsed_Cycles;
+
+	// Fire at "ticks" Complete Ticks after the last Tick
+	SysTick->LOAD = (uint32)((sint32)(ticks * OS_TICK_PERIOD_CYCLES) - L_Elapsed_Cycles) - 1;
+	SysTick->VAL = 0;
+	SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+	return 1;
+}
+
+uint32 Ticker_Resume(void)
+{
+	uint32 L_Ctrl , L_Elapsed_Ticks = 0 , L_Next_Tick_Cycles;
+	sint32 L_Elapsed_Cycles , L_Tick_Phase_Cycles;
+
+	// Stop the Counter: Reading the CTRL clears the COUNTFLAG ===> it is Tested in the Values Read here
+	// (the 2nd Read catches the Counter reaching Zero between the 1st Read and the Stop)
+	L_Ctrl = SysTick->CTRL;
+	SysTick->CTRL = L_Ctrl & ~SysTick_CTRL_ENABLE_Msk;
+	L_Ctrl |= SysTick->CTRL;
+
+	// Cycles elapsed since the last Tick credited to the OS (the Counter is Stopped)
+	L_Elapsed_Cycles = Ticker_Elapsed_Cycles + ((SysTick->VAL != 0) ? (sint32)((SysTick->LOAD + 1) - SysTick->VAL) : 0);
+
+	if(L_Ctrl & SysTick_CTRL_COUNTFLAG_Msk)
+	{
+		// The Suppressed Period has completely elapsed ===> Credited here , and not again by a Pending Systick
+		L_Elapsed_Cycles += (sint32)(SysTick->LOAD + 1);
+		SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
+	}
+
+	Ticker_Suppressed = 0;
+
+	// Only the Complete Ticks are credited , the Partial Tick is kept by the Phase of the Next Tick
+	if(L_Elapsed_Cycles > 0)
+	{
+		L_Elapsed_Ticks = (uint32)L_Elapsed_Cycles / OS_TICK_PERIOD_CYCLES;
+	}
+	L_Tick_Phase_Cycles = L_Elapsed_Cycles - (sint32)(L_Elapsed_Ticks * OS_TICK_PERIOD_CYCLES);
+	L_Next_Tick_Cycles = (uint32)((sint32)OS_TICK_PERIOD_CYCLES - L_Tick_Phase_Cycles);
+
+	if(L_Next_Tick_Cycles < (2 * TICKER_MIN_RELOAD_CYCLES))
+	{
+		// Too close to the Next Tick to be Split ===> the Next Tick is credited now (Early by less than 2 * TICKER_MIN_RELOAD_CYCLES) ,
+		// and the Following one is Realigned
+		L_Elapsed_Ticks++;
+		L_Tick_Phase_Cycles -= OS_TICK_PERIOD_CYCLES;
+		L_Next_Tick_Cycles += OS_TICK_PERIOD_CYCLES;
+	}
+
+	if(L_Next_Tick_Cycles == OS_TICK_PERIOD_CYCLES)
+	{
+		// Exactly on the Tick boundary ===> the Periodic Tick restarts directly
+		SysTick->LOAD = OS_TICK_PERIOD_CYCLES - 1;
+	}
+	else
+	{
+		// The Partial Period is Counted in 2 Halves: the Mid-Period Interrupt Reloads the 2nd Half , and its Systick Handler restores
+		// the 1msec LOAD (Ticker_Realign) , taken by the Reload at the Tick boundary ===> No Waiting for the Reload here
+		// (an Odd Partial Period is 1 cycle shorter)
+		Ticker_Realign_Cycles = L_Next_Tick_Cycles / 2;
+		Ticker_Elapsed_Cycles = L_Tick_Phase_Cycles + (sint32)(L_Next_Tick_Cycles % 2);
+		Ticker_Realigning = 1;
+		SysTick->LOAD = Ticker_Realign_Cycles - 1;
+	}
+	SysTick->VAL = 0;
+	SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+	return L_Elapsed_Ticks;
+}
+
+uint8 Ticker_Realign(void)
+{
+	// Note: Called by every Systick Interrupt
+	if(Ticker_Realigning == 1)
+	{
+		// The Mid-Period Interrupt (the Counter already Reloaded the 2nd Half) ===> the 1msec Period starts at the Next Reload (the Tick)
+		SysTick->LOAD = OS_TICK_PERIOD_CYCLES - 1;
+		Ticker_Elapsed_Cycles += (sint32)Ticker_Realign_Cycles;
+		Ticker_Realigning = 2;
+		return 0;
+	}
+
+	Ticker_Realigning = 0;
+	return 1;
+}
+
+uint32 Ticker_Get_Elapsed_Cycles(void)
+{
+	// Note: Must be called in Handler Mode or by a Privileged Task
+	sint32 L_Elapsed_Cycles = Ticker_Counted_Cycles();
+
+	// A Tick credited Early by Ticker_Resume must not make the Time go backward (before it , and when its Following Tick is credited)
+	if(L_Elapsed_Cycles < 0)
+	{
+		L_Elapsed_Cycles = 0;
+	}
+	else if((Ticker_Realigning != 0) && (L_Elapsed_Cycles >= (sint32)OS_TICK_PERIOD_CYCLES))
+	{
+		L_Elapsed_Cycles = OS_TICK_PERIOD_CYCLES - 1;
+	}
+
+	return (uint32)L_Elapsed_Cycles;
+}
@@ -0,0 +1,262 @@
+/*
+ * Host_OS_Porting.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Youssef Samy
+ */
+
+#include <errno.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <time.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include "Scheduler.h"
+
+uint32 Host_RAM[HOST_RAM_SIZE / 4];
+vuint32 Host_PendSV_Pending;
+
+static sigset_t Host_Interrupts_Mask; // SysTick and IRQs Signals
+static void (*Host_IRQ_Handlers[HOST_IRQS_NUM])(void);
+static const int Host_IRQ_Signals[HOST_IRQS_NUM] = {SIGUSR1, SIGUSR2};
+static uint8 Ticker_Suppressed;
+static struct timespec Ticker_Last_Tick_Time; // Time of the last Tick credited to the OS
+
+typedef struct
+{
+	ucontext_t Context;
+	uint8 Stack[HOST_TASK_STACK_SIZE];
+}Host_Task_Context;
+
+
+// OS Layer Handlers (Scheduler.c)
+void Samy_OS_SVC_Services(OS_Register *StackFrame_ptr);
+void SysTick_Handler(void);
+
+static void PendSV_Handler(void)
+{
+	// The OS State is updated by the OS (Scheduler.c) , the Current_PSP of each Task holds its Host_Task_Context
+	Tasks_ref *p_Previous_Task;
+	Tasks_ref *p_Current_Task;
+
+	Host_PendSV_Pending = 0;
+
+	p_Previous_Task = Samy_OS_Switch_Current_Task();
+	p_Current_Task = Samy_OS_Get_Current_Task();
+
+	// Context SAVE of the Previous Task , and Context RESTORE of the Current Task
+	if(p_Current_Task != p_Previous_Task)
+	{
+		swapcontext((ucontext_t*)p_Previous_Task->Current_PSP, (ucontext_t*)p_Current_Task->Current_PSP);
+	}
+}
+
+static void Host_Exception_Return(void)
+{
+	// The PendSV has the Lowest Priority ===> it runs when the SVC/SysTick returns
+	if(Host_PendSV_Pending)
+	{
+		PendSV_Handler();
+	}
+}
+
+static void Host_SysTick_Signal(int signal_number)
+{
+	int L_errno = errno;
+
+	(void)signal_number;
+
+	if(Ticker_Suppressed == 0)
+	{
+		clock_gettime(CLOCK_MONOTONIC, &Ticker_Last_Tick_Time);
+	}
+	SysTick_Handler();
+	Host_Exception_Return();
+
+	errno = L_errno;
+}
+
+static void Host_IRQ_Signal(int signal_number)
+{
+	int L_errno = errno;
+	uint32 i;
+
+	for(i = 0 ; i < HOST_IRQS_NUM ; i++)
+	{
+		if((Host_IRQ_Signals[i] == signal_number) && (Host_IRQ_Handlers[i] != NULL))
+		{
+			Host_IRQ_Handlers[i]();
+		}
+	}
+	Host_Exception_Return();
+
+	errno = L_errno;
+}
+
+static uint64 Host_Elapsed_Nano_Seconds(const struct timespec *p_Start)
+{
+	struct timespec L_Now;
+
+	clock_gettime(CLOCK_MONOTONIC, &L_Now);
+
+	return ((uint64)(L_Now.tv_sec - p_Start->tv_sec) * 1000000000ULL) + (uint64)(L_Now.tv_nsec - p_Start->tv_nsec);
+}
+
+static void Host_Set_Timer(uint32 first_ticks)
+{
+	struct itimerval L_Timer;
+
+	// 1 Tick = 1msec
+	L_Timer.it_value.tv_sec = first_ticks / 1000;
+	L_Timer.it_value.tv_usec = (first_ticks % 1000) * 1000;
+	L_Timer.it_interval.tv_sec = 0;
+	L_Timer.it_interval.tv_usec = 1000;
+
+	setitimer(ITIMER_REAL, &L_Timer, NULL);
+}
+
+
+OS_Register OS_SVC_Call(uint32 service_id , OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2)
+{
+	// Same Stacked Frame as the Cortex-M (R0,R1,R2,R3,R12,LR,PC,xPSR)
+	OS_Register StackFrame[8] = {argument_0, argument_1, argument_2, 0, service_id, 0, 0, 0};
+	sigset_t L_Old_Mask;
+
+	// The SVC can not be Preempted by the SysTick or an IRQ
+	sigprocmask(SIG_BLOCK, &Host_Interrupts_Mask, &L_Old_Mask);
+
+	Samy_OS_SVC_Services(StackFrame);
+	Host_Exception_Return();
+
+	sigprocmask(SIG_SETMASK, &L_Old_Mask, NULL);
+
+	return StackFrame[0];
+}
+
+void HW_Init(void)
+{
+	struct sigaction L_Action;
+
+	uint32 i;
+
+	sigemptyset(&Host_Interrupts_Mask);
+	sigaddset(&Host_Interrupts_Mask, SIGALRM);
+	for(i = 0 ; i < HOST_IRQS_NUM ; i++)
+	{
+		sigaddset(&Host_Interrupts_Mask, Host_IRQ_Signals[i]);
+	}
+
+	// The SysTick and the IRQs don't Preempt each other (the OS_ENTER_CRITICAL of the Host Port Masks nothing)
+	L_Action.sa_handler = Host_SysTick_Signal;
+	L_Action.sa_flags = SA_RESTART;
+	L_Action.sa_mask = Host_Interrupts_Mask;
+	sigaction(SIGALRM, &L_Action, NULL);
+}
+
+void Host_IRQ_Init(uint32 irq_number , void (*pf_IRQ_Handler)(void))
+{
+	struct sigaction L_Action;
+
+	Host_IRQ_Handlers[irq_number] = pf_IRQ_Handler;
+
+	L_Action.sa_handler = Host_IRQ_Signal;
+	L_Action.sa_flags = SA_RESTART;
+	L_Action.sa_mask = Host_Interrupts_Mask;
+	sigaction(Host_IRQ_Signals[irq_number], &L_Action, NULL);
+}
+
+void Host_Trigger_IRQ(uint32 irq_number)
+{
+	// Runs the Handler now if the Interrupts are not Masked , else when they are Unmasked (as NVIC_SetPendingIRQ)
+	raise(Host_IRQ_Signals[irq_number]);
+}
+
+uint32* Stack_Frame_Init(uint32 *p_Stack_Top , void (*pf_Task_Entry)(void))
+{
+	Host_Task_Context *p_Context = malloc(sizeof(Host_Task_Context));
+
+	(void)p_Stack_Top;
+
+	if(p_Context == NULL)
+	{
+		abort();
+	}
+
+	getcontext(&p_Context->Context);
+	p_Context->Context.uc_stack.ss_sp = p_Context->Stack;
+	p_Context->Context.uc_stack.ss_size = sizeof(p_Context->Stack);
+	p_Context->Context.uc_link = NULL;
+	sigemptyset(&p_Context->Context.uc_sigmask); // Tasks start with the SysTick Enabled
+	makecontext(&p_Context->Context, pf_Task_Entry, 0);
+
+	return (uint32*)p_Context;
+}
+
+void Start_Ticker(void)
+{
+	clock_gettime(CLOCK_MONOTONIC, &Ticker_Last_Tick_Time);
+	Host_Set_Timer(1); // Periodic Tick = 1msec
+}
+
+uint8 Ticker_Suppress(uint32 ticks)
+{
+	sigset_t L_Pending;
+
+	if(ticks > OS_TICKLESS_MAX_TICKS)
+	{
+		ticks = OS_TICKLESS_MAX_TICKS;
+	}
+
+	// A SysTick Signal Pending (Masked by the SVC) is not credited yet ===> the Periodic Tick is kept (Same as the Cortex-M Port)
+	sigpending(&L_Pending);
+	if(sigismember(&L_Pending, SIGALRM))
+	{
+		return 0;
+	}
+
+	Ticker_Suppressed = 1;
+
+	Host_Set_Timer(ticks);
+
+	return 1;
+}
+
+uint32 Ticker_Resume(void)
+{
+	// Only the Complete Ticks are credited , the Partial Tick stays in the Elapsed time of the Next Tick
+	uint32 L_Elapsed_Ticks = (uint32)(Host_Elapsed_Nano_Seconds(&Ticker_Last_Tick_Time) / OS_TICK_PERIOD_CYCLES);
+	uint64 L_Last_Tick_ns = (uint64)Ticker_Last_Tick_Time.tv_nsec + ((uint64)L_Elapsed_Ticks * OS_TICK_PERIOD_CYCLES);
+
+	Ticker_Last_Tick_Time.tv_sec += L_Last_Tick_ns / 1000000000ULL;
+	Ticker_Last_Tick_Time.tv_nsec = L_Last_Tick_ns % 1000000000ULL;
+	Ticker_Suppressed = 0;
+
+	Host_Set_Timer(1);
+
+	return L_Elapsed_Ticks;
+}
+
+uint8 Ticker_Realign(void)
+{
+	return 1;
+}
+
+uint32 Ticker_Get_Elapsed_Cycles(void)
+{
+	uint64 L_Elapsed_ns = Host_Elapsed_Nano_Seconds(&Ticker_Last_Tick_Time);
+
+	// A Delayed SysTick Signal must not make the Time go backward when it credits the tick
+	if((Ticker_Suppressed == 0) && (L_Elapsed_ns >= OS_TICK_PERIOD_CYCLES))
+	{
+		L_Elapsed_ns = OS_TICK_PERIOD_CYCLES - 1;
+	}
+
+	return (uint32)L_Elapsed_ns;
+}
+
+void Host_Wait_For_Event(void)
+{
+	pause();
+}
@@ -7,82 +7,66 @@
 
 #include "Samy_OS_FIFO.h"
 
-FIFO_STATUS QUEUE_init(FIFO_BUFF *buffer , element_type *ptr_arr , uint32 length)
+FIFO_STATUS QUEUE_init(FIFO_BUFF *buffer , void *ptr_arr , uint32 length , uint32 element_size)
 {
-	if(!ptr_arr)
+	// The Index Masking needs a Power of 2 length
+	if(!ptr_arr || !element_size || !FIFO_IS_POWER_OF_2(length))
 	{
 		return QUEUE_NULL;
 	}
-	buffer->base = ptr_arr;
-	buffer->head = buffer->base;
-	buffer->tail = buffer->base;
+	buffer->base = (uint8*)ptr_arr;
+	buffer->head = 0;
+	buffer->tail = 0;
 
-	buffer->count = 0;
 	buffer->length = length;
+	buffer->mask = length - 1;
+	buffer->element_size = element_size;
 
 	return QUEUE_NO_ERROR;
 }
 
 
-FIFO_STATUS Enqueue_item(FIFO_BUFF *buffer , element_type item)
+FIFO_STATUS Enqueue_item(FIFO_BUFF *buffer , const void *ptr_item)
 {
 
 	// Check if Buffer Exists
-	if(!buffer->base || !buffer->length)
+	if(!buffer->base)
 	{
 		return QUEUE_NULL;
 	}
 
 	// Check if Buffer is Full
-	if((buffer->head == buffer->tail) && (buffer->count == buffer->length))
+	if((buffer->tail - buffer->head) == buffer->length)
 	{
 		return QUEUE_FULL;
 	}
 
-	*(buffer->tail) = item;
-	buffer->count++;
-
-	// Check for Circular FIFO
-	if(buffer->tail == (((uint32)buffer->base + (4*buffer->length))- 4 ) )
-	{
-		buffer->tail = buffer->base;
-	}
-	else
-	{
-		buffer->tail++;
-	}
+	// Circular FIFO: the Free-Running Index is Masked to its Place in the Buffer
+	Memory_Copy(buffer->base + ((buffer->tail & buffer->mask) * buffer->element_size), (const uint8*)ptr_item, buffer->element_size);
+	buffer->tail++;
 
 	return QUEUE_NO_ERROR;
 }
 
 
-FIFO_STATUS Dequeue_item(FIFO_BUFF *buffer , element_type *ptr_item)
+FIFO_STATUS Dequeue_item(FIFO_BUFF *buffer , void *ptr_item)
 {
 
 	// Check if Buffer Exists
-	if(!buffer->base || !buffer->length)
+	if(!buffer->base)
 	{
 		return QUEUE_NULL;
 	}
 
 	// Check if Buffer is Empty
-	if(buffer->head == buffer->tail)
+	if(buffer->tail == buffer->head)
 	{
 		return QUEUE_EMPTY;
 	}
 
-	*ptr_item = *(buffer->head);
-	buffer->count--;
-
-	// Check for Circular FIFO
-	if(buffer->head == (((uint32)buffer->base + (4*buffer->length )) - 4 ))
-	{
-		buffer->head = buffer->base;
-	}
-	else
-	{
-		buffer->head++;
-	}
+	// Circular FIFO: the Free-Running Index is Masked to its Place in the Buffer
+	Memory_Copy((uint8*)ptr_item, buffer->base + ((buffer->head & buffer->mask) * buffer->element_size), buffer->element_size);
+	buffer->head++;
 
 	return QUEUE_NO_ERROR;
 }
@@ -92,7 +76,7 @@ FIFO_STATUS Is_Queue_Full(FIFO_BUFF *buffer)
 {
 	FIFO_STATUS status = QUEUE_NO_ERROR;
 
-	if(buffer->count == buffer->length)
+	if((buffer->tail - buffer->head) == buffer->length)
 	{
 		status = QUEUE_FULL;
 	}
@@ -104,10 +88,16 @@ FIFO_STATUS Is_Queue_Empty(FIFO_BUFF *buffer)
 {
 	FIFO_STATUS status = QUEUE_NO_ERROR;
 
-	if(buffer->count == 0) // or it can also be if(buffer->head == buffer->tail)
+	if(buffer->tail == buffer->head)
 	{
 		status = QUEUE_EMPTY;
 	}
 
 	return status;
 }
+
+
+uint32 Queue_Count(FIFO_BUFF *buffer)
+{
+	return buffer->tail - buffer->head;
+}
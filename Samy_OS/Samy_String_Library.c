@@ -160,3 +160,13 @@ uint32 String_Compare(uint8 *ptr1 , uint8 *ptr2)
 	}
 	return res;
 }
+
+
+void Memory_Copy(uint8 *ptr1 , const uint8 *ptr2 , uint32 size)
+{
+	uint32 i;
+	for(i = 0 ; i < size ; i++)
+	{
+		ptr1[i] = ptr2[i];
+	}
+}
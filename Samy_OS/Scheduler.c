@@ -7,29 +7,64 @@
 
 
 #include "Scheduler.h"
-#include "Samy_OS_FIFO.h"
 
 
 uint8 Idle_Task_LED, SysTick_LED; // For Testing
 
-FIFO_BUFF Ready_FIFO; // Queue for the Ready Tasks
-Tasks_ref *Ready_QUEUE[MAX_TASKS_NUM];
 static Tasks_ref Idle_Task;
 
 
+/*
+	Ready Structure:
+	---------------
+	Each Priority has its own Ready List (Circular Doubly Linked List through Tasks_ref->Ready_Next/Ready_Prev)
+	And a Two-Level Bitmap marks which Priorities have Ready Tasks:
+	* Ready_Group_Bitmap      : Bit (31 - Group) is set if any Priority in that Group has a Ready Task
+	* Ready_Priority_Bitmap[] : Bit (31 - (Priority % 32)) in Word (Priority / 32) is set if that Priority has a Ready Task
+
+	The Bits are stored in reverse order , so the CLZ instruction directly gives the Highest Priority (Lowest Number)
+	===> Finding the Next Task costs 2 CLZ instructions , regardless of the number of Tasks or Priorities
+*/
+// Round-Robin Time Quantum of the Task (in ticks)
+#define OS_TASK_TIME_SLICE(p_Task)	(((p_Task)->Task_Time_Slice != 0) ? (p_Task)->Task_Time_Slice : OS_DEFAULT_TIME_SLICE)
+
+// Mutex Lock Word: the Owner Address , and Bit 0 Set while the Mutex is managed by the OS (the Tasks Addresses are Word-Aligned)
+#define MUTEX_LOCK_KERNEL			((OS_Register)0x1)
+#define MUTEX_OWNER(p_Mutex)		((Tasks_ref*)((p_Mutex)->Lock_Word & ~MUTEX_LOCK_KERNEL))
+
+static Tasks_ref *Ready_List[OS_PRIORITY_LEVELS];
+static uint32 Ready_Group_Bitmap;
+static uint32 Ready_Priority_Bitmap[OS_PRIORITY_GROUPS];
+
+
+/*
+	Waiting List:
+	------------
+	The Waiting Tasks are kept in a Delta List sorted by their Wake-up time (Linked through Tasks_ref->Task_Waiting_Time.Next/Prev)
+	Each Task holds its ticks "relative to the previous Task" in the List , So the Systick only decrements the Head of the List ,
+	and only touches the Tasks which actually expire in this tick.
+*/
+static Tasks_ref *Waiting_List_Head;
+
+#if OS_TICKLESS_IDLE
+static uint8 Tickless_Idle_Active; // Set while the Periodic Tick is Suppressed (Only the Idle Task is Running)
+#endif
+
+
 struct
 {
+	/********** Context Switching (Must be the First members: accessed by the PendSV_Handler in CortexMX_OS_Porting.c) **********/
+	Tasks_ref *Current_Task;
+	Tasks_ref *Next_Task;
+
 	/********** Scheduling Table **********/
 	Tasks_ref *OS_Tasks[MAX_TASKS_NUM]; // Array of Pointers to Struct , each struct which is the task :)
 
 	uint8  Tasks_Num;
 
-	uint32 _S_MSP_OS;
-	uint32 _E_MSP_OS;
-	uint32 _PSP_Task_Locator; // Holding Address of the Next Task which will be Allocated in its Stack
-
-	Tasks_ref *Current_Task;
-	Tasks_ref *Next_Task;
+	OS_Register _S_MSP_OS;
+	OS_Register _E_MSP_OS;
+	OS_Register _PSP_Task_Locator; // Holding Address of the Next Task which will be Allocated in its Stack
 
 	enum
 	{
@@ -38,16 +73,37 @@ struct
 		OS_ERROR
 	}OS_Mode_ID;
 
+	uint32 Avoided_Context_Switches; // Scheduling Decisions which kept the Running Task (PendSV not Triggered)
+
+	vuint64 Tick_Count; // OS Time: ticks since starting the OS (Written with the Interrupts Masked , Read by Samy_OS_Read_Tick_Count)
+
 }OS_Control;
 
+// The PendSV_Handler (Assembly) depends on these Offsets
+_Static_assert(__builtin_offsetof(Tasks_ref, Current_PSP) == 0, "Current_PSP must be the First member of Tasks_ref");
+_Static_assert(__builtin_offsetof(__typeof__(OS_Control), Current_Task) == 0, "Current_Task must be at Offset 0 of OS_Control");
+_Static_assert(__builtin_offsetof(__typeof__(OS_Control), Next_Task) == sizeof(Tasks_ref*), "Next_Task must be at Offset 4 of OS_Control");
+
 
 typedef enum
 {
 	SVC_Activate_Task,
 	SVC_Terminate_Task,
 	SVC_Waiting_Task,
+	SVC_Waiting_Until_Task,
 	SVC_Acquire_Mutex,
-	SVC_Release_Mutex
+	SVC_Release_Mutex,
+	SVC_Get_Timestamp,
+	SVC_Take_Semaphore,
+	SVC_Give_Semaphore,
+	SVC_Notify_Task,
+	SVC_Wait_Notification,
+	SVC_Set_Event_Bits,
+	SVC_Wait_Event_Bits,
+	SVC_Send_Message,
+	SVC_Receive_Message,
+
+	SVC_Services_Num
 }SVC_ID;
 
 /****************************************************************************************************************************/
@@ -56,13 +112,84 @@ typedef enum
 static void Samy_OS_Create_MainSTACK(void);
 static void Samy_OS_Idle_Task(void); // this task has the lowest priority(255), Runs only in case of no other Running Tasks
 static void Samy_OS_Task_Stack_Init(Tasks_ref *new_task);
-static void Samy_OS_SVC_Call(SVC_ID service_id);
-
-static void Samy_OS_Update_Scheduler_Table_and_Ready_QUEUE(void);
-static void Samy_OS_Bubble_Sort_Scheduler_Table(void);
+static void Samy_OS_Periodic_Task(void); // Entry of the Periodic Tasks , calls the Task Function once every Period
+
+// OS Services (Executed in Handler Mode through the SVC)
+static OS_Register Samy_OS_Service_Activate_Task(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2);
+static OS_Register Samy_OS_Service_Terminate_Task(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2);
+static OS_Register Samy_OS_Service_Waiting_Task(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2);
+static OS_Register Samy_OS_Service_Waiting_Until_Task(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2);
+static OS_Register Samy_OS_Service_Acquire_Mutex(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2);
+static OS_Register Samy_OS_Service_Release_Mutex(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2);
+static OS_Register Samy_OS_Service_Get_Timestamp(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2);
+static OS_Register Samy_OS_Service_Take_Semaphore(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2);
+static OS_Register Samy_OS_Service_Give_Semaphore(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2);
+static OS_Register Samy_OS_Service_Notify_Task(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2);
+static OS_Register Samy_OS_Service_Wait_Notification(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2);
+static OS_Register Samy_OS_Service_Set_Event_Bits(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2);
+static OS_Register Samy_OS_Service_Wait_Event_Bits(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2);
+static OS_Register Samy_OS_Service_Send_Message(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2);
+static OS_Register Samy_OS_Service_Receive_Message(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2);
+
+static void Samy_OS_Set_Task_Priority(Tasks_ref *p_Task , uint8 priority);
+static uint8 Samy_OS_Get_Mutexes_Priority(Tasks_ref *p_Task);
+static void Samy_OS_Mutex_Owners_Update(Mutex_ref *p_Mutex);
+static void Samy_OS_Held_Mutexes_Insert(Tasks_ref *p_Task , Mutex_ref *p_Mutex);
+static void Samy_OS_Held_Mutexes_Remove(Tasks_ref *p_Task , Mutex_ref *p_Mutex);
+static void Samy_OS_Schedule(void);
+
+static void Samy_OS_Ready_List_Insert(Tasks_ref *p_Task);
+static void Samy_OS_Ready_List_Remove(Tasks_ref *p_Task);
+static uint8 Samy_OS_Get_Highest_Ready_Priority(void);
+static void Samy_OS_Round_Robin_Rotate(void);
+
+static void Samy_OS_Waiting_List_Insert(Tasks_ref *p_Task , uint32 ticks);
+static void Samy_OS_Waiting_List_Remove(Tasks_ref *p_Task);
+
+static void Samy_OS_Wait_Queue_Insert(Wait_Queue_ref *p_Wait_Queue , Tasks_ref *p_Task);
+static void Samy_OS_Wait_Queue_Remove(Tasks_ref *p_Task);
+
+static void Samy_OS_Block_Task(Tasks_ref *p_Task , Wait_Queue_ref *p_Wait_Queue , uint32 timeout);
+static void Samy_OS_Wake_Up_Task(Tasks_ref *p_Task , Samy_OS_Status wake_up_status);
+static void Samy_OS_Cancel_Blocking(Tasks_ref *p_Task);
+static void Samy_OS_Receive_Notification(Tasks_ref *p_Task);
+static uint8 Samy_OS_Event_Wait_Satisfied(Tasks_ref *p_Task , uint32 event_bits);
+static void Samy_OS_Event_Group_Update(Event_Group_ref *p_Event_Group);
+static Samy_OS_Status Samy_OS_Message_Queue_Put(Message_Queue_ref *p_Message_Queue , const void *p_Message);
 
 static void Samy_OS_Decide_Next_Task(void);
-static void Samy_OS_Update_Tasks_Waiting_Time(void);
+static void Samy_OS_Update_Tasks_Waiting_Time(uint32 elapsed_ticks);
+static uint64 Samy_OS_Read_Tick_Count(void);
+static uint64 Samy_OS_Read_Timestamp(void);
+#if OS_TICKLESS_IDLE
+static void Samy_OS_Tickless_Idle_Exit(void);
+static void Samy_OS_Tickless_Idle_Enter(Tasks_ref *p_Selected_Task);
+#endif
+
+/****************************************************************************************************************************/
+
+
+// OS Services Table (Indexed by the Service Number passed in R12)
+typedef OS_Register (*pf_SVC_Service)(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2);
+
+static const pf_SVC_Service SVC_Services_Table[SVC_Services_Num] =
+{
+	Samy_OS_Service_Activate_Task,		// SVC_Activate_Task
+	Samy_OS_Service_Terminate_Task,		// SVC_Terminate_Task
+	Samy_OS_Service_Waiting_Task,		// SVC_Waiting_Task
+	Samy_OS_Service_Waiting_Until_Task,	// SVC_Waiting_Until_Task
+	Samy_OS_Service_Acquire_Mutex,		// SVC_Acquire_Mutex
+	Samy_OS_Service_Release_Mutex,		// SVC_Release_Mutex
+	Samy_OS_Service_Get_Timestamp,		// SVC_Get_Timestamp
+	Samy_OS_Service_Take_Semaphore,		// SVC_Take_Semaphore
+	Samy_OS_Service_Give_Semaphore,		// SVC_Give_Semaphore
+	Samy_OS_Service_Notify_Task,		// SVC_Notify_Task
+	Samy_OS_Service_Wait_Notification,	// SVC_Wait_Notification
+	Samy_OS_Service_Set_Event_Bits,		// SVC_Set_Event_Bits
+	Samy_OS_Service_Wait_Event_Bits,	// SVC_Wait_Event_Bits
+	Samy_OS_Service_Send_Message,		// SVC_Send_Message
+	Samy_OS_Service_Receive_Message		// SVC_Receive_Message
+};
 
 /****************************************************************************************************************************/
 
@@ -78,14 +205,8 @@ Samy_OS_Status Samy_OS_Init(void)
 	// Creating the Main Stack Boundaries for OS
 	Samy_OS_Create_MainSTACK();
 
-	// Create Ready Queue for OS
-	if(QUEUE_init(&Ready_FIFO, Ready_QUEUE, MAX_TASKS_NUM) != QUEUE_NO_ERROR)
-	{
-		L_OS_status = Ready_QUEUE_Init_ERROR;
-	}
-
 	// Configure the IDLE Task (in Case no running Tasks)
-	String_Copy((uint8*)&(Idle_Task.Task_Name), (uint8*)"IdleTask"); // Task Name
+	String_Copy((uint8*)&(Idle_Task.Task_Name), (uint8*)"IdleTask"); // Task Name (Debug only , the OS identifies the Idle Task by its Address)
 	Idle_Task.Task_Priority = 255; // Lowest Priority uint8 = 255; , (Runs in case of no any Running Tasks)
 	Idle_Task.pf_Task_Entry = Samy_OS_Idle_Task;
 	Idle_Task.Task_Stack_Size = 300;
@@ -103,24 +224,40 @@ Samy_OS_Status Samy_OS_Create_Task(Tasks_ref *new_task)
 	new_task->_S_PSP_Task = OS_Control._PSP_Task_Locator;
 	new_task->_E_PSP_Task = (new_task->_S_PSP_Task) - (new_task->Task_Stack_Size); // Remember: ARM Cortex-M stack is descending stack
 
+	// Check if the Scheduling Table is Full
+	if(OS_Control.Tasks_Num >= MAX_TASKS_NUM)
+	{
+		L_OS_status = Tasks_Reached_Max_Num;
+	}
 	// Check if Task_Stack_Size entered by the user exceed the PSP Stack or not
-	if(new_task->_E_PSP_Task < (uint32)&_eheap)
+	else if(new_task->_E_PSP_Task < (OS_Register)&_eheap)
 	{
 		L_OS_status = Task_Exceeded_Stack_Size;
 	}
+	else
+	{
+		// Initialize the Stack Region for the Task (Initializing all the CPU Registers in the Task Stack)
+		Samy_OS_Task_Stack_Init(new_task);
 
-	// Initialize the Stack Region for the Task (Initializing all the CPU Registers in the Task Stack)
-	Samy_OS_Task_Stack_Init(new_task);
-
-	// Align 8Bytes between this task and the Next one
-	OS_Control._PSP_Task_Locator = (new_task->_E_PSP_Task) - 8;
+		// Align 8Bytes between this task and the Next one
+		OS_Control._PSP_Task_Locator = (new_task->_E_PSP_Task) - 8;
 
-	// Adding the Task in the Scheduling Table (which is an array of Pointers to struct)
-	OS_Control.OS_Tasks[OS_Control.Tasks_Num] = new_task;
-	OS_Control.Tasks_Num++;
+		// Adding the Task in the Scheduling Table (which is an array of Pointers to struct)
+		OS_Control.OS_Tasks[OS_Control.Tasks_Num] = new_task;
+		OS_Control.Tasks_Num++;
+	}
 
-	// Initially, The created task is in the Suspended State
+	// Initially, The created task is in the Suspended State (Not Linked in any Ready List)
 	new_task->Task_State = Suspended;
+	new_task->Ready_Next = NULL;
+	new_task->Ready_Prev = NULL;
+	new_task->Task_Waiting_Time.Task_Blocking_State = disabled;
+	new_task->Task_Blocked_On.p_Wait_Queue = NULL;
+	new_task->Task_Blocked_On.p_Mutex = NULL;
+	new_task->Task_Base_Priority = new_task->Task_Priority;
+	new_task->Held_Mutexes = NULL;
+	new_task->Task_Notification.Value = 0;
+	new_task->Task_Notification.State = Notification_None;
 
 	return L_OS_status;
 }
@@ -129,27 +266,25 @@ Samy_OS_Status Samy_OS_Create_Task(Tasks_ref *new_task)
 
 void Samy_OS_Activate_Task(Tasks_ref *p_Task)
 {
-	p_Task->Task_State = Waiting;
-	Samy_OS_SVC_Call(SVC_Activate_Task);
-
+	OS_SVC_Call(SVC_Activate_Task, (OS_Register)p_Task, 0, 0);
 }
 
 
 
 void Samy_OS_Terminate_Task(Tasks_ref *p_Task)
 {
-	p_Task->Task_State = Suspended;
-	Samy_OS_SVC_Call(SVC_Terminate_Task);
+	OS_SVC_Call(SVC_Terminate_Task, (OS_Register)p_Task, 0, 0);
 }
 
 void Samy_OS_Start_OS(void)
 {
-	OS_Control.OS_Mode_ID = OS_Running;
-
 	// Set the Default Current Task (idle task),This is in Case no tasks had been created (the idle task has the least Priority)
 	OS_Control.Current_Task = &Idle_Task;
 	Samy_OS_Activate_Task(&Idle_Task);
 
+	// The OS Schedules the Tasks starting from the First Systick (the Idle Task is Running until then)
+	OS_Control.OS_Mode_ID = OS_Running;
+
 	// Start the Systick Timer
 	Start_Ticker();
 
@@ -157,489 +292,1528 @@ void Samy_OS_Start_OS(void)
 	OS_SET_PSP(OS_Control.Current_Task->Current_PSP);
 	OS_SWITCH_SP_to_PSP();
 
+#if OS_UNPRIVILEGED_TASKS
 	// Switch to Thread Mode and Unprivileged Access
 	Switch_CPU_Access_Level_to_Unprivileged();
+#endif
 	OS_Control.Current_Task->pf_Task_Entry();
 }
 
 
 void Samy_OS_Task_Wait(uint32 ticks , Tasks_ref *p_Task)
 {
-	p_Task->Task_Waiting_Time.Task_Blocking_State = enabled;
-	p_Task->Task_Waiting_Time.ticks = ticks;
-
-	// Here , We implement the Task waiting state "as if" it is in the Suspended mode until the waiting ticks expires , then removing it from the Suspended state again
-	p_Task->Task_State = Suspended;
-	Samy_OS_SVC_Call(SVC_Terminate_Task);
+	// The OS moves the Task from its Ready List to the Waiting List , until the waiting ticks expires
+	if(ticks != 0)
+	{
+		OS_SVC_Call(SVC_Waiting_Task, (OS_Register)p_Task, ticks, 0);
+	}
 }
 
+void Samy_OS_Task_Wait_Until(uint32 *p_Previous_Release , uint32 period , Tasks_ref *p_Task)
+{
+	// The Next Release is calculated in Handler Mode (No tick can happen between reading the OS Time and Blocking the Task)
+	OS_SVC_Call(SVC_Waiting_Until_Task, (OS_Register)p_Task, (OS_Register)p_Previous_Release, period);
+}
 
-Samy_OS_Status Samy_OS_Acquire_Mutex(Tasks_ref *p_Task , Mutex_ref *p_Mutex)
+uint64 Samy_OS_Get_Tick_Count(void)
 {
-	Samy_OS_Status L_OS_status = No_Error;
-	if(p_Mutex->Current_User == NULL) // Not Taken by any User
-	{
-		p_Mutex->Current_User = p_Task;
+	return Samy_OS_Read_Tick_Count();
+}
 
-		// Check for Priority Ceiling
-		if(p_Mutex->Mutex_Priority_Ceiling.State == Priority_Ceiling_Enabled)
-		{
-			// Save Current Task Priority , to return it to the task after releasing the Mutex
-			p_Mutex->Mutex_Priority_Ceiling.Old_Priority = p_Task->Task_Priority; // or (p_Mutex->Current_User->Task_Priority)
+uint64 Samy_OS_Get_Timestamp(void)
+{
+	uint64 L_Timestamp;
 
-			// Promote the Priority of the Task Required the Mutex ===> to the Ceiling Priority
-			p_Mutex->Current_User->Task_Priority = p_Mutex->Mutex_Priority_Ceiling.Ceiling_Priority;
-		}
-	}
-	else if(p_Mutex->Current_User == p_Task) // the task already Acquired the Mutex Before
+	if(OS_IS_PRIVILEGED())
 	{
-		L_OS_status = Mutex_Already_Acquired;
-	}
-	else if(p_Mutex->Next_User == NULL) // Mutex Acquired , but not Pending Request by other next tasks
-	{
-		p_Mutex->Next_User = p_Task;
-		p_Mutex->Next_User->Task_State == Suspended; // Suspend Task Until the Mutex is released by the Other Task
-		Samy_OS_SVC_Call(SVC_Terminate_Task);
+		L_Timestamp = Samy_OS_Read_Timestamp();
 	}
-	else // Mutex Acquired , and Also Pending Request by other Task
+	else
 	{
-		L_OS_status = Mutex_Reached_Max_No_Of_Users;
+		// The Unprivileged Tasks can't access the Systick Registers ===> the OS reads the Timestamp for them
+		OS_SVC_Call(SVC_Get_Timestamp, (OS_Register)&L_Timestamp, 0, 0);
 	}
 
-	return L_OS_status;
+	return L_Timestamp;
 }
 
-void Samy_OS_Release_Mutex(Mutex_ref *p_Mutex)
-{
-	if(p_Mutex->Current_User != NULL)
-	{
-		// Check for Priority Ceiling
-		if(p_Mutex->Mutex_Priority_Ceiling.State == Priority_Ceiling_Enabled)
-		{
-			// Restore the Original Priority to the Promoted task when mutex was acquired
-			p_Mutex->Current_User->Task_Priority = p_Mutex->Mutex_Priority_Ceiling.Old_Priority;
-		}
-
 
-		if(p_Mutex->Next_User == NULL) // No Any Pending Requests for the Mutex
-		{
-			p_Mutex->Current_User = NULL;
-		}
-		else // p_Mutex->Next_User != NULL , So the Pending Task now can Acquire the Mutex and be Activated
-		{
-			p_Mutex->Current_User = p_Mutex->Next_User;
-			p_Mutex->Next_User = NULL;
-
-			p_Mutex->Current_User->Task_State = Waiting;
-
-			if(p_Mutex->Mutex_Priority_Ceiling.State == Priority_Ceiling_Enabled)
-			{
-				// Save Current Task Priority , to return it to the task after releasing the Mutex
-				p_Mutex->Mutex_Priority_Ceiling.Old_Priority = p_Mutex->Current_User->Task_Priority;
-
-				// Promote the Priority of the Task Required the Mutex ===> to the Ceiling Priority
-				p_Mutex->Current_User->Task_Priority = p_Mutex->Mutex_Priority_Ceiling.Ceiling_Priority;
-			}
+uint32 Samy_OS_Get_Avoided_Context_Switches(void)
+{
+	return OS_Control.Avoided_Context_Switches;
+}
 
-			Samy_OS_SVC_Call(SVC_Activate_Task);
-		}
-	}
+Tasks_ref* Samy_OS_Get_Current_Task(void)
+{
+	return OS_Control.Current_Task;
 }
 
+Tasks_ref* Samy_OS_Switch_Current_Task(void)
+{
+	Tasks_ref *p_Previous_Task = OS_Control.Current_Task;
 
-/****************************************************************************************************************************/
+	// Same Update as the Cortex-M PendSV_Handler: Current_Task = Next_Task , then No Switch is Pending
+	if(OS_Control.Next_Task != NULL)
+	{
+		OS_Control.Current_Task = OS_Control.Next_Task;
+		OS_Control.Next_Task = NULL;
+	}
 
+	return p_Previous_Task;
+}
 
-// ==========================>     STATIC APIs     <==========================
 
-static void Samy_OS_Create_MainSTACK(void)
+Samy_OS_Status Samy_OS_Acquire_Mutex(Tasks_ref *p_Task , Mutex_ref *p_Mutex)
 {
-	OS_Control._S_MSP_OS = (uint32)&_estack;
-	OS_Control._E_MSP_OS = OS_Control._S_MSP_OS - MAIN_Stack_SIZE;
-
-	// Aligning 8 Bytes between the Main Stack & the Process Stack
-	OS_Control._PSP_Task_Locator = OS_Control._E_MSP_OS -  8;
+	return Samy_OS_Acquire_Mutex_Timeout(p_Task, p_Mutex, OS_WAIT_FOREVER);
 }
 
-
-static void Samy_OS_Idle_Task(void)
+Samy_OS_Status Samy_OS_Try_Acquire_Mutex(Tasks_ref *p_Task , Mutex_ref *p_Mutex)
 {
-	while(1)
-	{
-		Idle_Task_LED ^= 1;
-		// Wait for event , to let Processor Enters Sleep Mode ==> to enhance CPU Utilization (Power Consumption)
-		__asm("WFE");
-	}
+	return Samy_OS_Acquire_Mutex_Timeout(p_Task, p_Mutex, 0);
 }
 
-static void Samy_OS_Task_Stack_Init(Tasks_ref *new_task)
+Samy_OS_Status Samy_OS_Acquire_Mutex_Timeout(Tasks_ref *p_Task , Mutex_ref *p_Mutex , uint32 timeout)
 {
-	/*
-		1- we need initially when creating each task to initialize ALL the CPU Registers from the start_psp of the task
-		   where it must be in order , for the Context Switching (Save/Restore) Operations ....
-
-		2- the Cortex-M Processor "Automatically" saves (xPSR , PC , LR , R12 , R3 , R2 , R1 , R0) when Interrupt Occurs
+	Samy_OS_Status L_OS_status = No_Error;
+	uint8 L_Claimed = 0;
 
-		3- So we need "Manually" to save all Other CPU Registers which are (R4,R5,R6,R7,R8,R9,R10,R11)
+	// Recursive Mutex Acquired again by its Owner ===> Counted , No SVC (only the Owner Task writes its Address in the Lock Word)
+	if((p_Mutex->Mutex_Type == Mutex_Recursive) && (MUTEX_OWNER(p_Mutex) == p_Task))
+	{
+		p_Mutex->Nesting_Count++;
+		L_Claimed = 1;
+	}
 
-		4- But Now, in this API , we are just "initializing" all the CPU Registers for Further Context Switching Operations
-		   (we can initialize by any dummy value , since the task is not in the running state yet)
+	// Fast Path: a Released Mutex is Claimed with LDREX/STREX ===> No SVC (the Priority Ceiling , Disabled by Default , needs the OS to Raise the Task)
+	// (Retried only if the Exclusive Store was Interrupted , while the Mutex is still Released)
+	if((L_Claimed == 0) && (p_Mutex->Mutex_Priority_Ceiling.State != Priority_Ceiling_Enabled))
+	{
+		while((L_Claimed == 0) && (p_Mutex->Lock_Word == 0))
+		{
+			L_Claimed = OS_Atomic_Compare_Exchange(&p_Mutex->Lock_Word, 0, (OS_Register)p_Task);
+		}
+	}
 
-	  	======> TASK FRAME <======
-	 * CPU Automatically Saved/Restored registers
-	 * ------------------------------------------
-	 * xPSR
-	 * PC (Next instruction to be executed in the task)
-	 * LR (return register which is saved in CPU before switching)
-	 * R12
-	 * R3
-	 * R2
-	 * R1
-	 * R0
-	 *
-	 * Manually Saved/Restored registers
-	 * ----------------------------------
-	 * R5
-	 * R5
-	 * R6
-	 * R7
-	 * R8
-	 * R9
-	 * R10
-	 * R11
-	 */
+	// Slow Path: the Mutex is Taken (the Task Blocks until it is handed the Mutex , or its timeout expires) , or has a Priority Ceiling
+	if(L_Claimed == 0)
+	{
+		OS_SVC_Call(SVC_Acquire_Mutex, (OS_Register)p_Task, (OS_Register)p_Mutex, timeout);
 
-	uint8 i;
+		// The Result is written in the Task by the OS , when the Mutex is Acquired or the timeout expires
+		L_OS_status = p_Task->Task_Blocked_On.Wake_Up_Status;
+	}
 
-	new_task->Current_PSP = (uint32*) new_task->_S_PSP_Task;
+	return L_OS_status;
+}
 
-	// xPSR dummy value -> T = 1 to avoid bus faults
-	new_task->Current_PSP--;
-	*(new_task->Current_PSP) = 0x01000000;
+void Samy_OS_Release_Mutex(Mutex_ref *p_Mutex)
+{
+	OS_Register L_Lock_Word = p_Mutex->Lock_Word;
+	uint8 L_Released = 0;
 
-	// PC dummy value -> Start at task entry point
-	new_task->Current_PSP--;
-	*(new_task->Current_PSP) = (uint32)new_task->pf_Task_Entry;
+	// The Mutex is Released if and only if it was Acquired by the Same Task (a Non-Owner neither Counts nor Releases it)
+	if(MUTEX_OWNER(p_Mutex) != Samy_OS_Get_Current_Task())
+	{
+		return;
+	}
 
-	// LR dummy value -> Return to thread mode with PSP
-	new_task->Current_PSP--;
-	*(new_task->Current_PSP) = 0xFFFFFFFD;
+	// Recursive Mutex still Acquired by Nested Acquirings of its Owner ===> only Counted , the Mutex is kept
+	if(p_Mutex->Nesting_Count != 0)
+	{
+		p_Mutex->Nesting_Count--;
+		return;
+	}
 
-	// CPU General Purpose Registers -> initialized by ZERO
-	for(i = 0 ; i<13 ; i++)
+	// Fast Path: the Mutex is not managed by the OS (No Waiters , No Priority Ceiling) ===> Released with LDREX/STREX , No SVC
+	while((L_Released == 0) && (L_Lock_Word != 0) && ((L_Lock_Word & MUTEX_LOCK_KERNEL) == 0))
 	{
-		new_task->Current_PSP--;
-		*(new_task->Current_PSP) = 0;
+		L_Released = OS_Atomic_Compare_Exchange(&p_Mutex->Lock_Word, L_Lock_Word, 0);
+		L_Lock_Word = p_Mutex->Lock_Word;
 	}
 
+	// Slow Path: the OS hands the Mutex to the Next Owner , and Restores the Priority of the Releasing Task
+	if((L_Released == 0) && (L_Lock_Word != 0))
+	{
+		OS_SVC_Call(SVC_Release_Mutex, (OS_Register)p_Mutex, 0, 0);
+	}
 }
 
-static void Samy_OS_SVC_Call(SVC_ID service_id)
-{
-	switch(service_id)
-	{
-		case SVC_Activate_Task:
-			__asm ("SVC #0x00"); // SVC_Handler (exceptional interrupt) in CortexMX_OS_Porting.c
-			break;
 
-		case SVC_Terminate_Task:
-			__asm ("SVC #0x01");
-			break;
+Samy_OS_Status Samy_OS_Take_Semaphore(Tasks_ref *p_Task , Semaphore_ref *p_Semaphore)
+{
+	return Samy_OS_Take_Semaphore_Timeout(p_Task, p_Semaphore, OS_WAIT_FOREVER);
+}
 
-		case SVC_Waiting_Task:
-			__asm ("SVC #0x02");
-			break;
+Samy_OS_Status Samy_OS_Try_Take_Semaphore(Tasks_ref *p_Task , Semaphore_ref *p_Semaphore)
+{
+	return Samy_OS_Take_Semaphore_Timeout(p_Task, p_Semaphore, 0);
+}
 
-		case SVC_Acquire_Mutex:
-			__asm ("SVC #0x03");
-			break;
+Samy_OS_Status Samy_OS_Take_Semaphore_Timeout(Tasks_ref *p_Task , Semaphore_ref *p_Semaphore , uint32 timeout)
+{
+	OS_SVC_Call(SVC_Take_Semaphore, (OS_Register)p_Task, (OS_Register)p_Semaphore, timeout);
 
-		case SVC_Release_Mutex:
-			__asm ("SVC #0x04");
-			break;
+	// The Result is written in the Task by the OS , when a Token is Taken or the timeout expires
+	return p_Task->Task_Blocked_On.Wake_Up_Status;
+}
 
-	}
+Samy_OS_Status Samy_OS_Give_Semaphore(Semaphore_ref *p_Semaphore)
+{
+	return (Samy_OS_Status)OS_SVC_Call(SVC_Give_Semaphore, (OS_Register)p_Semaphore, 0, 0);
 }
 
-static void Samy_OS_Update_Scheduler_Table_and_Ready_QUEUE(void)
+Samy_OS_Status Samy_OS_Give_Semaphore_From_ISR(Semaphore_ref *p_Semaphore)
 {
-	Tasks_ref *temp = NULL;
-	uint8 i = 0;
-	Tasks_ref *p_task , *p_next_task;
+	Samy_OS_Status L_OS_status;
+	uint32 L_Interrupts_State;
 
-	// Sorting the Scheduler table from the Highest Priority to the Lowest Priority
-	Samy_OS_Bubble_Sort_Scheduler_Table();
+	// An Interrupt may have Preempted the Systick Handler ===> the Service runs directly with the Interrupts Masked , instead of the SVC
+	// (the PendSV has the Lowest Priority , So the Context Switching happens after all the Interrupts return)
+	OS_ENTER_CRITICAL(L_Interrupts_State);
+	L_OS_status = (Samy_OS_Status)Samy_OS_Service_Give_Semaphore((OS_Register)p_Semaphore, 0, 0);
+	OS_EXIT_CRITICAL(L_Interrupts_State);
 
-	// Free Ready QUEUE
-	while(Dequeue_item(&Ready_FIFO, &temp) != QUEUE_EMPTY);
+	return L_OS_status;
+}
 
-	// Update Ready QUEUE
-	while(i < OS_Control.Tasks_Num)
-	{
-		p_task = OS_Control.OS_Tasks[i];
-		p_next_task = OS_Control.OS_Tasks[i+1];
 
-		if( (p_task->Task_State) != Suspended )
-		{
-			// In case we reached to the end of available OSTasks
-			if( (p_next_task->Task_State) == Suspended)
-			{
-				Enqueue_item(&Ready_FIFO, p_task);
-				p_task->Task_State = Ready;
-				break;
-			}
-			// Check for Priority
-			if((p_task->Task_Priority) < (p_next_task->Task_Priority))
-			{
-				Enqueue_item(&Ready_FIFO, p_task);
-				p_task->Task_State = Ready;
-				break;
-			}
-			else if((p_task->Task_Priority) == (p_next_task->Task_Priority))
-			{
-				Enqueue_item(&Ready_FIFO, p_task);
-				p_task->Task_State = Ready;
-			}
-			else if((p_task->Task_Priority) > (p_next_task->Task_Priority))
-			{
-				// NOT Allowed , because we already Sorted the Tasks
-				break;
-			}
+Samy_OS_Status Samy_OS_Notify_Task(Tasks_ref *p_Task , uint32 value , Samy_OS_Notify_Action action)
+{
+	return (Samy_OS_Status)OS_SVC_Call(SVC_Notify_Task, (OS_Register)p_Task, value, action);
+}
 
-		}
+Samy_OS_Status Samy_OS_Notify_Task_From_ISR(Tasks_ref *p_Task , uint32 value , Samy_OS_Notify_Action action)
+{
+	Samy_OS_Status L_OS_status;
+	uint32 L_Interrupts_State;
 
-		i++;
-	}
+	// Same as Samy_OS_Give_Semaphore_From_ISR: the Service runs directly with the Interrupts Masked
+	OS_ENTER_CRITICAL(L_Interrupts_State);
+	L_OS_status = (Samy_OS_Status)Samy_OS_Service_Notify_Task((OS_Register)p_Task, value, action);
+	OS_EXIT_CRITICAL(L_Interrupts_State);
 
+	return L_OS_status;
 }
 
-static void Samy_OS_Bubble_Sort_Scheduler_Table(void)
+Samy_OS_Status Samy_OS_Wait_Notification(Tasks_ref *p_Task , uint32 clear_bits_on_exit , uint32 *p_Value , uint32 timeout)
 {
-	uint8 num = OS_Control.Tasks_Num;
-	uint8 i , j;
-	Tasks_ref *temp = NULL;
-	uint8 sorted_flag;
-	for(i=0 ; i < (num-1) ; i++)
+	Samy_OS_Status L_OS_status;
+
+	OS_SVC_Call(SVC_Wait_Notification, (OS_Register)p_Task, clear_bits_on_exit, timeout);
+
+	// The Result is written in the Task by the OS , when the Notification is Received or the timeout expires
+	L_OS_status = p_Task->Task_Blocked_On.Wake_Up_Status;
+
+	if((L_OS_status == No_Error) && (p_Value != NULL))
 	{
-		sorted_flag = 1;
-		for(j=0 ; j < (num-i-1) ; j++)
-		{
-			if((OS_Control.OS_Tasks[j+1]->Task_Priority) < (OS_Control.OS_Tasks[j]->Task_Priority))
-			{
-				// Swap
-				temp = OS_Control.OS_Tasks[j];
-				OS_Control.OS_Tasks[j] = OS_Control.OS_Tasks[j+1];
-				OS_Control.OS_Tasks[j+1] = temp;
-				sorted_flag = 0;
-			}
-		}
-		if(sorted_flag == 1)
-		{
-			break;
-		}
+		*p_Value = p_Task->Task_Notification.Received_Value;
 	}
 
+	return L_OS_status;
 }
 
 
-static void Samy_OS_Decide_Next_Task(void)
+Samy_OS_Status Samy_OS_Set_Event_Bits(Event_Group_ref *p_Event_Group , uint32 bits)
 {
-	// If Ready Queue is empty && OS_Control->CurrentTask != Suspended
-	if( (Ready_FIFO.count == 0) && (OS_Control.Current_Task->Task_State != Suspended) )
-	{
-		OS_Control.Current_Task->Task_State = Running;
+	return (Samy_OS_Status)OS_SVC_Call(SVC_Set_Event_Bits, (OS_Register)p_Event_Group, bits, 0);
+}
 
-		// Add the Current Task Again (Round-Robin)
-		Enqueue_item(&Ready_FIFO, OS_Control.Current_Task);
-		OS_Control.Next_Task = OS_Control.Current_Task;
-	}
-	else
-	{
-		Dequeue_item(&Ready_FIFO, &OS_Control.Next_Task);
-		OS_Control.Next_Task->Task_State = Running;
+Samy_OS_Status Samy_OS_Set_Event_Bits_From_ISR(Event_Group_ref *p_Event_Group , uint32 bits)
+{
+	uint32 L_Interrupts_State;
 
-		// Update Ready Queue(To keep the Round-Robin Algorithm)
-		if(((OS_Control.Current_Task->Task_Priority) == (OS_Control.Next_Task->Task_Priority)) && (OS_Control.Current_Task->Task_State != Suspended) )
-		{
-			Enqueue_item(&Ready_FIFO, OS_Control.Current_Task);
-			OS_Control.Current_Task->Task_State = Ready;
-		}
+	// Atomic against the Nested Interrupts , without Masking them (Bit-Band Stores on the Cortex-M3)
+	OS_Atomic_Set_Bits(&p_Event_Group->Event_Bits, bits);
+
+	// The Interrupts are Masked only when Tasks are Blocked on the Group , to Ready them (See Samy_OS_Give_Semaphore_From_ISR)
+	if(p_Event_Group->Waiting_Tasks.Head != NULL)
+	{
+		OS_ENTER_CRITICAL(L_Interrupts_State);
+		Samy_OS_Event_Group_Update(p_Event_Group);
+		OS_EXIT_CRITICAL(L_Interrupts_State);
 	}
 
+	return No_Error;
 }
 
-static void Samy_OS_Update_Tasks_Waiting_Time(void)
+Samy_OS_Status Samy_OS_Clear_Event_Bits(Event_Group_ref *p_Event_Group , uint32 bits)
 {
-	// Note: This API is called by the Systick Handler every Sys-Tick
-	uint8 i;
-	for(i = 0 ; i < OS_Control.Tasks_Num ; i++)
-	{
-		if(OS_Control.OS_Tasks[i]->Task_State == Suspended)
-		{
-			if(OS_Control.OS_Tasks[i]->Task_Waiting_Time.Task_Blocking_State == enabled)
-			{
-				OS_Control.OS_Tasks[i]->Task_Waiting_Time.ticks--;
-
-				if(OS_Control.OS_Tasks[i]->Task_Waiting_Time.ticks == 0)
-				{
-					OS_Control.OS_Tasks[i]->Task_Waiting_Time.Task_Blocking_State = disabled;
-					OS_Control.OS_Tasks[i]->Task_State = Waiting;
-
-					Samy_OS_SVC_Call(SVC_Waiting_Task);
-				}
-			}
+	// Clearing Bits never Readies a Task ===> No OS Service is needed
+	OS_Atomic_Clear_Bits(&p_Event_Group->Event_Bits, bits);
 
-		}
-	}
+	return No_Error;
 }
-/****************************************************************************************************************************/
 
-
-/*
-	This API (Samy_OS_SVC_Services) executes specific OS Services , Branched by the SVC_Handler Exceptional Interrupt.
-	REMARK:
-	------
-	We didn't put this Code in the SVC_Handler
-	===> to Abstract the Processor Architecture (Vector table) or the MCAL Layer (which is found in the CortexMX_OS_Porting.c)
-		 with the OS Layer
-*/
-void Samy_OS_SVC_Services(uint32 *StackFrame_ptr)
+Samy_OS_Status Samy_OS_Wait_Event_Bits(Tasks_ref *p_Task , Event_Group_ref *p_Event_Group , uint32 bits , uint8 options , uint32 *p_Event_Bits , uint32 timeout)
 {
-	/*
-		We will extract the SVC_Number in this API to be able to execute the required service ,
-		This is done by starting from R0 which is the default argument , which is holding the stack frame pointer,
-		So ===> R0 ===> Argument 0 ===> StackFrame_ptr
-		Stack Frame:
-		-----------
-		* xPSR
-		* PC <======== StackFrame_ptr[6]
-		* LR
-		* R12
-		* R3
-		* R2
-		* R1
-		* R0 <======== StackFrame_ptr
+	Samy_OS_Status L_OS_status;
 
-		So PC = Instruction which is immediately after the SVC Instruction
-		So (StackFrame_ptr[6]- 2 ) = SVC #SVC_Number
-		===> SVC instruction is 16-Bit , where SVC_Number is stored in the Least Byte)
-	*/
-	uint8 SVC_Number;
-	SVC_Number = *((uint8*)((uint8*)(StackFrame_ptr[6])) - 2) ; // it can also be written as: SVC_Number =  ((uint8*)StackFrame_ptr[6]) [-2];
-	switch(SVC_Number)
-	{
-		case SVC_Activate_Task:
-		case SVC_Terminate_Task:
-		case SVC_Waiting_Task:
-		case SVC_Acquire_Mutex:
-		case SVC_Release_Mutex:
+	// The Wait Condition is kept in the Task , to be checked by the OS whenever Bits of the Group are Set
+	p_Task->Task_Blocked_On.Event_Bits = bits;
+	p_Task->Task_Blocked_On.Event_Options = options;
 
-		// Update Scheduler Table and Ready Queue
-		Samy_OS_Update_Scheduler_Table_and_Ready_QUEUE();
+	OS_SVC_Call(SVC_Wait_Event_Bits, (OS_Register)p_Task, (OS_Register)p_Event_Group, timeout);
 
-		// If OS is in running state -> Decide what next task
-		if(OS_Control.OS_Mode_ID == OS_Running)
-		{
-			if(String_Compare((uint8*)OS_Control.Current_Task->Task_Name, (uint8*)"IdleTask") != 0)
-			{
-				Samy_OS_Decide_Next_Task();
+	L_OS_status = p_Task->Task_Blocked_On.Wake_Up_Status;
 
-				// =====> CONTEXT SWITCHING <=====
-				Trigger_OS_PendSV(); // Macro for Triggering PendSV Exceptional Interrupt
-			}
-		}
-		break;
+	if((L_OS_status == No_Error) && (p_Event_Bits != NULL))
+	{
+		*p_Event_Bits = p_Task->Task_Blocked_On.Event_Bits;
 	}
 
+	return L_OS_status;
 }
 
-__attribute ((naked)) void PendSV_Handler()
-{
-	/*
-		================>	1- Context SAVE 	<================
-		As mentioned above (in the Samy_OS_SVC_Services API) ...
-		that the Processor saves by default some registers which are (xPSR,PC,LR,R12,R3,R2,R1,R0)
-		So Now we will Save the Others registers in the Task Control Block (TCB).
-		These Registers are (R4,R5,R6,R7,R8,R9,R10,R11)
-	*/
-
-	//Save the Current PSP Register for the Task in the OS_Control.Current_Task->Current_PSP
-	OS_GET_PSP(OS_Control.Current_Task->Current_PSP);
 
-	// Small Note: We decrement the Pointer first as the Cortex-M Stack is "FULL" Descending Stack (Points to the last pushed data not to the empty region)
-	OS_Control.Current_Task->Current_PSP--;
-	__asm volatile("MOV %0, R4" : "=r" (*(OS_Control.Current_Task->Current_PSP)));
-
-	OS_Control.Current_Task->Current_PSP--;
-	__asm volatile("MOV %0, R5" : "=r" (*(OS_Control.Current_Task->Current_PSP)));
+Samy_OS_Status Samy_OS_Create_Message_Queue(Message_Queue_ref *p_Message_Queue)
+{
+	Samy_OS_Status L_OS_status = No_Error;
 
-	OS_Control.Current_Task->Current_PSP--;
-	__asm volatile("MOV %0, R6" : "=r" (*(OS_Control.Current_Task->Current_PSP)));
+	if(QUEUE_init(&p_Message_Queue->Messages, p_Message_Queue->p_Buffer, p_Message_Queue->Max_Messages, p_Message_Queue->Message_Size) != QUEUE_NO_ERROR)
+	{
+		L_OS_status = Message_Queue_Init_ERROR;
+	}
 
-	OS_Control.Current_Task->Current_PSP--;
-	__asm volatile("MOV %0, R7" : "=r" (*(OS_Control.Current_Task->Current_PSP)));
+	// Empty Wait Queues (the FIFO Insert appends after the Tail)
+	p_Message_Queue->Receivers.Head = NULL;
+	p_Message_Queue->Receivers.Tail = NULL;
+	p_Message_Queue->Senders.Head = NULL;
+	p_Message_Queue->Senders.Tail = NULL;
 
-	OS_Control.Current_Task->Current_PSP--;
-	__asm volatile("MOV %0, R8" : "=r" (*(OS_Control.Current_Task->Current_PSP)));
+	return L_OS_status;
+}
 
-	OS_Control.Current_Task->Current_PSP--;
-	__asm volatile("MOV %0, R9" : "=r" (*(OS_Control.Current_Task->Current_PSP)));
+Samy_OS_Status Samy_OS_Send_Message(Tasks_ref *p_Task , Message_Queue_ref *p_Message_Queue , const void *p_Message , uint32 timeout)
+{
+	// The Message is kept in the Task , to be Copied by the OS when the Queue has a Free Place
+	p_Task->Task_Blocked_On.p_Message = (void*)p_Message;
 
-	OS_Control.Current_Task->Current_PSP--;
-	__asm volatile("MOV %0, R10" : "=r" (*(OS_Control.Current_Task->Current_PSP)));
+	OS_SVC_Call(SVC_Send_Message, (OS_Register)p_Task, (OS_Register)p_Message_Queue, timeout);
 
-	OS_Control.Current_Task->Current_PSP--;
-	__asm volatile("MOV %0, R11" : "=r" (*(OS_Control.Current_Task->Current_PSP)));
+	return p_Task->Task_Blocked_On.Wake_Up_Status;
+}
 
+Samy_OS_Status Samy_OS_Send_Message_From_ISR(Message_Queue_ref *p_Message_Queue , const void *p_Message)
+{
+	Samy_OS_Status L_OS_status;
+	uint32 L_Interrupts_State;
 
-	// ================>	2- Context RESTORE of Next Task (same idea) 	<================
+	// Same as Samy_OS_Give_Semaphore_From_ISR: the Message is Queued directly with the Interrupts Masked
+	OS_ENTER_CRITICAL(L_Interrupts_State);
+	L_OS_status = Samy_OS_Message_Queue_Put(p_Message_Queue, p_Message);
+	OS_EXIT_CRITICAL(L_Interrupts_State);
 
-	if(OS_Control.Next_Task != NULL)
-	{
-		OS_Control.Current_Task = OS_Control.Next_Task;
-		OS_Control.Next_Task = NULL;
-	}
-	__asm volatile("MOV R11, %0" : : "r" (*(OS_Control.Current_Task->Current_PSP)));
-	OS_Control.Current_Task->Current_PSP++;
+	return L_OS_status;
+}
 
-	__asm volatile("MOV R10, %0" : : "r" (*(OS_Control.Current_Task->Current_PSP)));
-	OS_Control.Current_Task->Current_PSP++;
+Samy_OS_Status Samy_OS_Receive_Message(Tasks_ref *p_Task , Message_Queue_ref *p_Message_Queue , void *p_Message , uint32 timeout)
+{
+	// The Receive Buffer is kept in the Task , to be Filled by the OS when a Message is Sent
+	p_Task->Task_Blocked_On.p_Message = p_Message;
 
-	__asm volatile("MOV R9, %0" : : "r" (*(OS_Control.Current_Task->Current_PSP)));
-	OS_Control.Current_Task->Current_PSP++;
+	OS_SVC_Call(SVC_Receive_Message, (OS_Register)p_Task, (OS_Register)p_Message_Queue, timeout);
 
-	__asm volatile("MOV R8, %0" : : "r" (*(OS_Control.Current_Task->Current_PSP)));
-	OS_Control.Current_Task->Current_PSP++;
+	return p_Task->Task_Blocked_On.Wake_Up_Status;
+}
 
-	__asm volatile("MOV R7, %0" : : "r" (*(OS_Control.Current_Task->Current_PSP)));
-	OS_Control.Current_Task->Current_PSP++;
 
-	__asm volatile("MOV R6, %0" : : "r" (*(OS_Control.Current_Task->Current_PSP)));
-	OS_Control.Current_Task->Current_PSP++;
+/****************************************************************************************************************************/
 
-	__asm volatile("MOV R5, %0" : : "r" (*(OS_Control.Current_Task->Current_PSP)));
-	OS_Control.Current_Task->Current_PSP++;
 
-	__asm volatile("MOV R4, %0" : : "r" (*(OS_Control.Current_Task->Current_PSP)));
-	OS_Control.Current_Task->Current_PSP++;
+// ==========================>     STATIC APIs     <==========================
 
-	// Update PSP and EXIT
-	OS_SET_PSP(OS_Control.Current_Task->Current_PSP);
-	__asm volatile("BX LR");
+static void Samy_OS_Create_MainSTACK(void)
+{
+	OS_Control._S_MSP_OS = (OS_Register)&_estack;
+	OS_Control._E_MSP_OS = OS_Control._S_MSP_OS - MAIN_Stack_SIZE;
 
+	// Aligning 8 Bytes between the Main Stack & the Process Stack
+	OS_Control._PSP_Task_Locator = OS_Control._E_MSP_OS -  8;
 }
 
-void SysTick_Handler()
-{
-	SysTick_LED ^= 1;
 
-	Samy_OS_Update_Tasks_Waiting_Time();
+static void Samy_OS_Idle_Task(void)
+{
+	while(1)
+	{
+		Idle_Task_LED ^= 1;
+		// Wait for event , to let Processor Enters Sleep Mode ==> to enhance CPU Utilization (Power Consumption)
+		OS_WAIT_FOR_EVENT();
+	}
+}
+
+static void Samy_OS_Task_Stack_Init(Tasks_ref *new_task)
+{
+	// The Periodic Tasks Start at the OS Entry (Samy_OS_Periodic_Task) , which Calls the Task Function every Period
+	void (*pf_Entry)(void) = (new_task->Task_Period != 0) ? Samy_OS_Periodic_Task : new_task->pf_Task_Entry;
+
+	// The Initial Task Frame depends on the Processor Architecture ===> it is Built by the Porting Layer (Stack_Frame_Init)
+	new_task->Current_PSP = Stack_Frame_Init((uint32*)new_task->_S_PSP_Task, pf_Entry);
+}
+
+static void Samy_OS_Periodic_Task(void)
+{
+	// Runs in Thread Mode as the Periodic Task itself: One Job (Task Function Call) per Period , Released by the OS at Absolute ticks
+	Tasks_ref *p_Self = Samy_OS_Get_Current_Task();
+
+	while(1)
+	{
+		p_Self->pf_Task_Entry();
+
+		Samy_OS_Task_Wait_Until(&p_Self->Task_Last_Release, p_Self->Task_Period, p_Self);
+	}
+}
+
+static void Samy_OS_Ready_List_Insert(Tasks_ref *p_Task)
+{
+	// Note: Must be called in Handler Mode only (SVC , SysTick) , as it modifies the Ready Structure
+	uint8 L_Priority = p_Task->Task_Priority;
+	Tasks_ref *p_Head = Ready_List[L_Priority];
+
+	// The Task is already Ready (Linked in its Ready List)
+	if(p_Task->Ready_Next != NULL)
+	{
+		return;
+	}
+
+	// A Newly Ready Task starts with a Full Time Slice
+	p_Task->Remaining_Time_Slice = OS_TASK_TIME_SLICE(p_Task);
+
+	if(p_Head == NULL)
+	{
+		// First Ready Task in this Priority ===> Mark the Priority in the Bitmap
+		p_Task->Ready_Next = p_Task;
+		p_Task->Ready_Prev = p_Task;
+		Ready_List[L_Priority] = p_Task;
+
+		Ready_Priority_Bitmap[L_Priority >> 5] |= (0x80000000UL >> (L_Priority & 0x1F));
+		Ready_Group_Bitmap |= (0x80000000UL >> (L_Priority >> 5));
+	}
+	else
+	{
+		// Add the Task at the Tail of the List (Before the Head) , to keep the Round-Robin order
+		p_Task->Ready_Next = p_Head;
+		p_Task->Ready_Prev = p_Head->Ready_Prev;
+		p_Head->Ready_Prev->Ready_Next = p_Task;
+		p_Head->Ready_Prev = p_Task;
+	}
+}
+
+static void Samy_OS_Ready_List_Remove(Tasks_ref *p_Task)
+{
+	// Note: Must be called in Handler Mode only (SVC , SysTick) , as it modifies the Ready Structure
+	uint8 L_Priority = p_Task->Task_Priority;
+
+	// The Task is not Ready (Not Linked in any Ready List)
+	if(p_Task->Ready_Next == NULL)
+	{
+		return;
+	}
+
+	if(p_Task->Ready_Next == p_Task)
+	{
+		// Last Ready Task in this Priority ===> Clear the Priority from the Bitmap
+		Ready_List[L_Priority] = NULL;
+
+		Ready_Priority_Bitmap[L_Priority >> 5] &= ~(0x80000000UL >> (L_Priority & 0x1F));
+		if(Ready_Priority_Bitmap[L_Priority >> 5] == 0)
+		{
+			Ready_Group_Bitmap &= ~(0x80000000UL >> (L_Priority >> 5));
+		}
+	}
+	else
+	{
+		p_Task->Ready_Prev->Ready_Next = p_Task->Ready_Next;
+		p_Task->Ready_Next->Ready_Prev = p_Task->Ready_Prev;
+
+		if(Ready_List[L_Priority] == p_Task)
+		{
+			Ready_List[L_Priority] = p_Task->Ready_Next;
+		}
+	}
+
+	p_Task->Ready_Next = NULL;
+	p_Task->Ready_Prev = NULL;
+}
+
+static uint8 Samy_OS_Get_Highest_Ready_Priority(void)
+{
+	// Note: the Idle Task is always Ready , So the Bitmap is never empty after starting the OS
+	uint32 L_Group = OS_COUNT_LEADING_ZEROS(Ready_Group_Bitmap);
+
+	return (uint8)((L_Group << 5) + OS_COUNT_LEADING_ZEROS(Ready_Priority_Bitmap[L_Group]));
+}
+
+static void Samy_OS_Round_Robin_Rotate(void)
+{
+	// Move the Current Task from the Head to the Tail of its Ready List when its Time Slice expires , to give the Same Priority Tasks their turn
+	// (A Preempted Task stays at the Head of its Ready List , So it continues its Remaining Time Slice when it Runs again)
+	Tasks_ref *p_Current = OS_Control.Current_Task;
+
+	if((p_Current->Ready_Next != NULL) && (Ready_List[p_Current->Task_Priority] == p_Current))
+	{
+		if(p_Current->Remaining_Time_Slice > 1)
+		{
+			p_Current->Remaining_Time_Slice--;
+		}
+		else
+		{
+			p_Current->Remaining_Time_Slice = OS_TASK_TIME_SLICE(p_Current);
+			Ready_List[p_Current->Task_Priority] = p_Current->Ready_Next;
+		}
+	}
+}
+
+static void Samy_OS_Decide_Next_Task(void)
+{
+	Tasks_ref *p_Highest_Task;
+
+#if OS_TICKLESS_IDLE
+	// An Interrupt ended the Tickless Idle ===> the Elapsed ticks are credited before the Decision
+	// (the Tasks expired during the Idle period are Readied , and the OS Time is up to date)
+	Samy_OS_Tickless_Idle_Exit();
+#endif
+
+	// The Head of the Highest Priority Ready List is the Next Task
+	p_Highest_Task = Ready_List[Samy_OS_Get_Highest_Ready_Priority()];
+
+	// A previous Decision (still Pending in the PendSV) is overridden by this one
+	if((OS_Control.Next_Task != NULL) && (OS_Control.Next_Task != p_Highest_Task) && (OS_Control.Next_Task->Task_State == Running))
+	{
+		OS_Control.Next_Task->Task_State = Ready;
+	}
+
+	if(p_Highest_Task == OS_Control.Current_Task)
+	{
+		// The Running Task keeps the CPU ===> No Context Switching is Needed
+		OS_Control.Next_Task = NULL;
+		OS_Control.Avoided_Context_Switches++;
+	}
+	else
+	{
+		if(OS_Control.Current_Task->Task_State == Running)
+		{
+			OS_Control.Current_Task->Task_State = Ready;
+		}
+		OS_Control.Next_Task = p_Highest_Task;
+	}
+	p_Highest_Task->Task_State = Running;
+
+#if OS_TICKLESS_IDLE
+	Samy_OS_Tickless_Idle_Enter(p_Highest_Task);
+#endif
+}
+
+#if OS_TICKLESS_IDLE
+static void Samy_OS_Tickless_Idle_Exit(void)
+{
+	// Note: Called before every Scheduling Decision (SVC , SysTick)
+	if(Tickless_Idle_Active == 1)
+	{
+		// Another Interrupt called the OS before the Earliest Wake-up ===> Credit the Elapsed ticks and Return to the Periodic Tick
+		// (if the Idle Task is Selected again , the Tick is Suppressed again by Samy_OS_Tickless_Idle_Enter)
+		uint32 L_Elapsed_Ticks = Ticker_Resume();
+
+		Tickless_Idle_Active = 0;
+#if OS_TICK_HOOK
+		Samy_OS_Tick_Hook(L_Elapsed_Ticks);
+#endif
+		Samy_OS_Update_Tasks_Waiting_Time(L_Elapsed_Ticks);
+	}
+}
+
+static void Samy_OS_Tickless_Idle_Enter(Tasks_ref *p_Selected_Task)
+{
+	// Note: Called after every Scheduling Decision (SVC , SysTick)
+	uint32 L_Idle_Ticks = OS_TICKLESS_MAX_TICKS;
+
+	if(p_Selected_Task == &Idle_Task)
+	{
+		// The Idle Task can Sleep until the Earliest Wake-up in the Waiting List
+		if(Waiting_List_Head != NULL)
+		{
+			L_Idle_Ticks = Waiting_List_Head->Task_Waiting_Time.ticks;
+		}
+
+		if(L_Idle_Ticks > 1)
+		{
+			Tickless_Idle_Active = Ticker_Suppress(L_Idle_Ticks);
+		}
+	}
+}
+#endif
+
+static void Samy_OS_Waiting_List_Insert(Tasks_ref *p_Task , uint32 ticks)
+{
+	// Note: Must be called in Handler Mode only (SVC) , as it modifies the Waiting List
+	Tasks_ref *p_Prev = NULL;
+	Tasks_ref *p_Node = Waiting_List_Head;
+
+	// Find the Position of the Task , Tasks having the Same Wake-up time keep their arrival order
+	while((p_Node != NULL) && (ticks >= p_Node->Task_Waiting_Time.ticks))
+	{
+		ticks -= p_Node->Task_Waiting_Time.ticks;
+		p_Prev = p_Node;
+		p_Node = p_Node->Task_Waiting_Time.Next;
+	}
+
+	p_Task->Task_Waiting_Time.ticks = ticks;
+	p_Task->Task_Waiting_Time.Prev = p_Prev;
+	p_Task->Task_Waiting_Time.Next = p_Node;
+	p_Task->Task_Waiting_Time.Task_Blocking_State = enabled;
+
+	if(p_Node != NULL)
+	{
+		// The Next Task now waits relative to the Inserted Task
+		p_Node->Task_Waiting_Time.ticks -= ticks;
+		p_Node->Task_Waiting_Time.Prev = p_Task;
+	}
+
+	if(p_Prev != NULL)
+	{
+		p_Prev->Task_Waiting_Time.Next = p_Task;
+	}
+	else
+	{
+		Waiting_List_Head = p_Task;
+	}
+}
+
+static void Samy_OS_Waiting_List_Remove(Tasks_ref *p_Task)
+{
+	// Note: Must be called in Handler Mode only (SVC , SysTick) , as it modifies the Waiting List
+	if(p_Task->Task_Waiting_Time.Task_Blocking_State != enabled)
+	{
+		return;
+	}
+
+	if(p_Task->Task_Waiting_Time.Next != NULL)
+	{
+		// Give the Remaining ticks of the Removed Task to the Next one , to keep its Wake-up time
+		p_Task->Task_Waiting_Time.Next->Task_Waiting_Time.ticks += p_Task->Task_Waiting_Time.ticks;
+		p_Task->Task_Waiting_Time.Next->Task_Waiting_Time.Prev = p_Task->Task_Waiting_Time.Prev;
+	}
+
+	if(p_Task->Task_Waiting_Time.Prev != NULL)
+	{
+		p_Task->Task_Waiting_Time.Prev->Task_Waiting_Time.Next = p_Task->Task_Waiting_Time.Next;
+	}
+	else
+	{
+		Waiting_List_Head = p_Task->Task_Waiting_Time.Next;
+	}
+
+	p_Task->Task_Waiting_Time.Task_Blocking_State = disabled;
+	p_Task->Task_Waiting_Time.Next = NULL;
+	p_Task->Task_Waiting_Time.Prev = NULL;
+}
+
+static void Samy_OS_Wait_Queue_Insert(Wait_Queue_ref *p_Wait_Queue , Tasks_ref *p_Task)
+{
+	// Note: Must be called in Handler Mode only (SVC , Interrupts inside the OS Critical Section) , as it modifies the Wait Queue
+	Tasks_ref *p_Prev = p_Wait_Queue->Tail;
+	Tasks_ref *p_Node = NULL;
+
+	// Priority Order: the Task is Placed after all the Higher and Same Priority Waiters ===> the Head is always the Next Task to be Woken-up
+	// FIFO Order: the Task is Appended after the Tail in constant time
+	if(p_Wait_Queue->Order == Wait_Queue_Priority_Order)
+	{
+		p_Prev = NULL;
+		p_Node = p_Wait_Queue->Head;
+
+		while((p_Node != NULL) && (p_Node->Task_Priority <= p_Task->Task_Priority))
+		{
+			p_Prev = p_Node;
+			p_Node = p_Node->Task_Blocked_On.Next;
+		}
+	}
+
+	p_Task->Task_Blocked_On.p_Wait_Queue = p_Wait_Queue;
+	p_Task->Task_Blocked_On.Prev = p_Prev;
+	p_Task->Task_Blocked_On.Next = p_Node;
+
+	if(p_Node != NULL)
+	{
+		p_Node->Task_Blocked_On.Prev = p_Task;
+	}
+	else
+	{
+		p_Wait_Queue->Tail = p_Task;
+	}
+
+	if(p_Prev != NULL)
+	{
+		p_Prev->Task_Blocked_On.Next = p_Task;
+	}
+	else
+	{
+		p_Wait_Queue->Head = p_Task;
+	}
+}
+
+static void Samy_OS_Wait_Queue_Remove(Tasks_ref *p_Task)
+{
+	// Note: Must be called in Handler Mode only (SVC , Interrupts inside the OS Critical Section) , as it modifies the Wait Queue
+	Wait_Queue_ref *p_Wait_Queue = p_Task->Task_Blocked_On.p_Wait_Queue;
+
+	// The Task is not Blocked on any Object
+	if(p_Wait_Queue == NULL)
+	{
+		return;
+	}
+
+	if(p_Task->Task_Blocked_On.Next != NULL)
+	{
+		p_Task->Task_Blocked_On.Next->Task_Blocked_On.Prev = p_Task->Task_Blocked_On.Prev;
+	}
+	else
+	{
+		p_Wait_Queue->Tail = p_Task->Task_Blocked_On.Prev;
+	}
+
+	if(p_Task->Task_Blocked_On.Prev != NULL)
+	{
+		p_Task->Task_Blocked_On.Prev->Task_Blocked_On.Next = p_Task->Task_Blocked_On.Next;
+	}
+	else
+	{
+		p_Wait_Queue->Head = p_Task->Task_Blocked_On.Next;
+	}
+
+	p_Task->Task_Blocked_On.p_Wait_Queue = NULL;
+	p_Task->Task_Blocked_On.Next = NULL;
+	p_Task->Task_Blocked_On.Prev = NULL;
+}
+
+static void Samy_OS_Block_Task(Tasks_ref *p_Task , Wait_Queue_ref *p_Wait_Queue , uint32 timeout)
+{
+	/*
+		Shared by all the Blocking Waits (Note: Must be called in Handler Mode only , the Caller Schedules after it):
+		The Task is Linked in the Wait Queue of the Object (if any) , and in the Waiting List until its timeout expires (if any)
+		===> Whichever comes first Wakes it up through Samy_OS_Wake_Up_Task , which Unlinks it from both in constant time
+	*/
+	Samy_OS_Ready_List_Remove(p_Task);
+
+	if(p_Wait_Queue != NULL)
+	{
+		Samy_OS_Wait_Queue_Insert(p_Wait_Queue, p_Task);
+	}
+
+	if(timeout != OS_WAIT_FOREVER)
+	{
+		Samy_OS_Waiting_List_Remove(p_Task);
+		Samy_OS_Waiting_List_Insert(p_Task, timeout);
+	}
+
+	p_Task->Task_State = Waiting;
+}
+
+static void Samy_OS_Wake_Up_Task(Tasks_ref *p_Task , Samy_OS_Status wake_up_status)
+{
+	// Note: Must be called in Handler Mode only (SVC , SysTick , Interrupts inside the OS Critical Section)
+	Samy_OS_Cancel_Blocking(p_Task);
+
+	// Read by the Blocking API of the Task , when it Runs again
+	p_Task->Task_Blocked_On.Wake_Up_Status = wake_up_status;
+
+	Samy_OS_Ready_List_Insert(p_Task);
+	p_Task->Task_State = Ready;
+}
+
+static void Samy_OS_Cancel_Blocking(Tasks_ref *p_Task)
+{
+	// Unlink the Task from everything it may be Blocked on (the Object Wait Queue , its Notification and the Waiting List)
+	Mutex_ref *p_Mutex = p_Task->Task_Blocked_On.p_Mutex;
+
+	// A Blocked Task leaving without a Wake-up (Activated again , or Terminated) doesn't see the Result of a previous Wait
+	// (a Wake-up Overwrites it with its own Result)
+	if(p_Task->Task_State == Waiting)
+	{
+		p_Task->Task_Blocked_On.Wake_Up_Status = Wait_Cancelled;
+	}
+
+	Samy_OS_Wait_Queue_Remove(p_Task);
+	Samy_OS_Waiting_List_Remove(p_Task);
+
+	// A Mutex Waiter left ===> the Priority it gave to the Owners (Priority Inheritance) is Re-evaluated
+	if(p_Mutex != NULL)
+	{
+		p_Task->Task_Blocked_On.p_Mutex = NULL;
+		Samy_OS_Mutex_Owners_Update(p_Mutex);
+	}
+
+	if(p_Task->Task_Notification.State == Notification_Waiting)
+	{
+		p_Task->Task_Notification.State = Notification_None;
+	}
+}
+
+static void Samy_OS_Receive_Notification(Tasks_ref *p_Task)
+{
+	// The Value is Received , then the Requested Bits are Cleared in the Same OS Service (No Notification is lost in between)
+	p_Task->Task_Notification.Received_Value = p_Task->Task_Notification.Value;
+	p_Task->Task_Notification.Value &= ~(p_Task->Task_Notification.Clear_Bits_On_Exit);
+	p_Task->Task_Notification.State = Notification_None;
+}
+
+static uint8 Samy_OS_Event_Wait_Satisfied(Tasks_ref *p_Task , uint32 event_bits)
+{
+	uint32 L_Waited_Bits = p_Task->Task_Blocked_On.Event_Bits;
+	uint8 L_Satisfied;
+
+	if(p_Task->Task_Blocked_On.Event_Options & Event_Wait_All)
+	{
+		L_Satisfied = ((event_bits & L_Waited_Bits) == L_Waited_Bits);
+	}
+	else
+	{
+		L_Satisfied = ((event_bits & L_Waited_Bits) != 0);
+	}
+
+	return L_Satisfied;
+}
+
+static void Samy_OS_Event_Group_Update(Event_Group_ref *p_Event_Group)
+{
+	// Note: Must be called in Handler Mode only (SVC , Interrupts inside the OS Critical Section)
+	Tasks_ref *p_Task = p_Event_Group->Waiting_Tasks.Head;
+	Tasks_ref *p_Next_Task;
+	uint32 L_Event_Bits = p_Event_Group->Event_Bits;
+	uint32 L_Clear_Bits = 0;
+	uint8 L_Woken_Up = 0;
+
+	// All the Blocked Tasks are checked against the Same Bits , then the Clear_On_Exit Bits are Cleared once
+	while(p_Task != NULL)
+	{
+		p_Next_Task = p_Task->Task_Blocked_On.Next;
+
+		if(Samy_OS_Event_Wait_Satisfied(p_Task, L_Event_Bits))
+		{
+			if(p_Task->Task_Blocked_On.Event_Options & Event_Clear_On_Exit)
+			{
+				L_Clear_Bits |= p_Task->Task_Blocked_On.Event_Bits;
+			}
+
+			p_Task->Task_Blocked_On.Event_Bits = L_Event_Bits;
+			Samy_OS_Wake_Up_Task(p_Task, No_Error);
+			L_Woken_Up = 1;
+		}
+
+		p_Task = p_Next_Task;
+	}
+
+	if(L_Clear_Bits != 0)
+	{
+		OS_Atomic_Clear_Bits(&p_Event_Group->Event_Bits, L_Clear_Bits);
+	}
+
+	if(L_Woken_Up == 1)
+	{
+		Samy_OS_Schedule();
+	}
+}
+
+static Samy_OS_Status Samy_OS_Message_Queue_Put(Message_Queue_ref *p_Message_Queue , const void *p_Message)
+{
+	// Note: Must be called in Handler Mode only (SVC , Interrupts inside the OS Critical Section)
+	Tasks_ref *p_Receiver = p_Message_Queue->Receivers.Head;
+	Samy_OS_Status L_OS_status = No_Error;
+
+	if(p_Receiver != NULL)
+	{
+		// A Receiver is Blocked (the Queue is Empty) ===> the Message is Copied directly to its Buffer , without passing by the Ring
+		Memory_Copy((uint8*)p_Receiver->Task_Blocked_On.p_Message, (const uint8*)p_Message, p_Message_Queue->Message_Size);
+		Samy_OS_Wake_Up_Task(p_Receiver, No_Error);
+
+		Samy_OS_Schedule();
+	}
+	else if(Enqueue_item(&p_Message_Queue->Messages, p_Message) != QUEUE_NO_ERROR)
+	{
+		L_OS_status = Message_Queue_Full;
+	}
+
+	return L_OS_status;
+}
+
+static void Samy_OS_Update_Tasks_Waiting_Time(uint32 elapsed_ticks)
+{
+	// Note: This API is called by the Systick Handler every Sys-Tick (elapsed_ticks = 1) , or after a Tickless Idle period
+	Tasks_ref *p_Task = Waiting_List_Head;
+
+	uint32 L_Interrupts_State;
+
+	// The 64-Bit OS Time is updated with the Interrupts Masked ===> No Reader (Task or Interrupt) sees a Half-Written value
+	OS_ENTER_CRITICAL(L_Interrupts_State);
+	OS_Control.Tick_Count += elapsed_ticks;
+	OS_EXIT_CRITICAL(L_Interrupts_State);
+
+	while((p_Task != NULL) && (elapsed_ticks != 0))
+	{
+		// Only the Head of the Delta List is decremented
+		if(p_Task->Task_Waiting_Time.ticks > elapsed_ticks)
+		{
+			p_Task->Task_Waiting_Time.ticks -= elapsed_ticks;
+			elapsed_ticks = 0;
+		}
+		else
+		{
+			elapsed_ticks -= p_Task->Task_Waiting_Time.ticks;
+			p_Task->Task_Waiting_Time.ticks = 0;
+		}
+
+		// Wake-up all the Tasks expiring in this tick (directly , without calling the SVC from the Systick Handler)
+		// (A Task Blocked on an Object or a Notification is also Unlinked from it , with the Wait_Timeout Result)
+		while((p_Task != NULL) && (p_Task->Task_Waiting_Time.ticks == 0))
+		{
+			Samy_OS_Wake_Up_Task(p_Task, Wait_Timeout);
+
+			p_Task = Waiting_List_Head;
+		}
+	}
+}
+
+static uint64 Samy_OS_Read_Tick_Count(void)
+{
+	// The 64-Bit Read is 2 Loads on a 32-Bit CPU ===> Read again if a tick was credited in between
+	uint64 L_Ticks;
+
+	do
+	{
+		L_Ticks = OS_Control.Tick_Count;
+	}while(L_Ticks != OS_Control.Tick_Count);
+
+	return L_Ticks;
+}
+
+static uint64 Samy_OS_Read_Timestamp(void)
+{
+	// Note: Must be called in Handler Mode or by a Privileged Task (Accessing the Systick Registers through Ticker_Get_Elapsed_Cycles)
+	uint64 L_Ticks;
+	uint32 L_Elapsed_Cycles;
+
+	// The Sub-tick part is counted from the Last tick credited to the OS ===> Read again if the Systick credited a tick in between
+	do
+	{
+		L_Ticks = Samy_OS_Read_Tick_Count();
+		L_Elapsed_Cycles = Ticker_Get_Elapsed_Cycles();
+	}while(L_Ticks != Samy_OS_Read_Tick_Count());
+
+	return (L_Ticks * OS_TICK_PERIOD_CYCLES) + L_Elapsed_Cycles;
+}
+/****************************************************************************************************************************/
+
+
+// ==========================>     OS SERVICES (Executed in Handler Mode through the SVC)     <==========================
+
+static OS_Register Samy_OS_Service_Activate_Task(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2)
+{
+	Tasks_ref *p_Task = (Tasks_ref*)argument_0;
+
+	// The Periods of a Periodic Task are counted from its Activation
+	p_Task->Task_Last_Release = (uint32)OS_Control.Tick_Count;
+
+	Samy_OS_Cancel_Blocking(p_Task);
+	Samy_OS_Ready_List_Insert(p_Task);
+	p_Task->Task_State = Ready;
+
+	Samy_OS_Schedule();
+
+	return No_Error;
+}
+
+static OS_Register Samy_OS_Service_Terminate_Task(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2)
+{
+	Tasks_ref *p_Task = (Tasks_ref*)argument_0;
+
+	Samy_OS_Cancel_Blocking(p_Task);
+	Samy_OS_Ready_List_Remove(p_Task);
+	p_Task->Task_State = Suspended;
+
+	Samy_OS_Schedule();
+
+	return No_Error;
+}
+
+static OS_Register Samy_OS_Service_Waiting_Task(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2)
+{
+	Tasks_ref *p_Task = (Tasks_ref*)argument_0;
+	uint32 ticks = (uint32)argument_1;
+
+	Samy_OS_Ready_List_Remove(p_Task);
+	Samy_OS_Waiting_List_Remove(p_Task);
+	Samy_OS_Waiting_List_Insert(p_Task, ticks);
+	p_Task->Task_State = Waiting;
+
+	Samy_OS_Schedule();
+
+	return No_Error;
+}
+
+static OS_Register Samy_OS_Service_Waiting_Until_Task(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2)
+{
+	uint32 *p_Previous_Release = (uint32*)argument_1;
+	uint32 L_Next_Release = *p_Previous_Release + (uint32)argument_2;
+	uint32 L_Ticks = L_Next_Release - (uint32)OS_Control.Tick_Count; // Modulo 2^32 ===> Correct across the Wrap-around
+
+	// The Release Time advances by exactly one Period ===> No Drift , whatever the Execution and Preemption time of the Task
+	*p_Previous_Release = L_Next_Release;
+
+	// The Next Release is still in the Future ===> Wait for it (Otherwise the Task Overran its Period , and continues immediately)
+	if((sint32)L_Ticks > 0)
+	{
+		Samy_OS_Service_Waiting_Task(argument_0, L_Ticks, 0);
+	}
+
+	return No_Error;
+}
+
+static OS_Register Samy_OS_Service_Acquire_Mutex(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2)
+{
+	Tasks_ref *p_Task = (Tasks_ref*)argument_0;
+	Mutex_ref *p_Mutex = (Mutex_ref*)argument_1;
+	uint32 timeout = (uint32)argument_2;
+	Tasks_ref *p_Owner = MUTEX_OWNER(p_Mutex);
+	Samy_OS_Status L_OS_status = No_Error;
+
+	if(p_Owner == NULL) // Not Taken by any User (Released meanwhile , or has a Priority Ceiling)
+	{
+		if(p_Mutex->Mutex_Priority_Ceiling.State == Priority_Ceiling_Enabled)
+		{
+			// Managed by the OS while held ===> Promote the Priority of the Task Required the Mutex to the Ceiling Priority
+			p_Mutex->Lock_Word = (OS_Register)p_Task | MUTEX_LOCK_KERNEL;
+			Samy_OS_Held_Mutexes_Insert(p_Task, p_Mutex);
+			Samy_OS_Set_Task_Priority(p_Task, Samy_OS_Get_Mutexes_Priority(p_Task));
+		}
+		else
+		{
+			p_Mutex->Lock_Word = (OS_Register)p_Task;
+		}
+	}
+	else if(p_Owner == p_Task) // the task already Acquired the Mutex Before
+	{
+		L_OS_status = Mutex_Already_Acquired;
+	}
+	else if(timeout == 0) // Mutex Acquired by another Task , and the Caller doesn't Block (Try)
+	{
+		L_OS_status = Wait_Timeout;
+	}
+	else // Mutex Acquired by another Task
+	{
+		// Contention: the Mutex is managed by the OS from now on (the Owner's Release enters the OS to hand it over)
+		// (a Release Interrupted between its LDREX and STREX fails its Exclusive Store , then sees the Bit)
+		if((p_Mutex->Lock_Word & MUTEX_LOCK_KERNEL) == 0)
+		{
+			p_Mutex->Lock_Word |= MUTEX_LOCK_KERNEL;
+			Samy_OS_Held_Mutexes_Insert(p_Owner, p_Mutex);
+		}
+
+		// Block the Task in the Mutex Wait Queue Until the Mutex is handed to it by a Release (No_Error) ,
+		// or its timeout expires (Wait_Timeout: Unlinked from the Wait Queue , and the Owners lose its Inherited Priority)
+		Samy_OS_Block_Task(p_Task, &p_Mutex->Waiting_Tasks, timeout);
+		p_Task->Task_Blocked_On.p_Mutex = p_Mutex;
+
+		// Check for Priority Inheritance ===> the Owner (and the Owners it is Blocked on) Runs at the Priority of the Task
+		if(p_Mutex->Mutex_Priority_Inheritance == Priority_Inheritance_Enabled)
+		{
+			Samy_OS_Mutex_Owners_Update(p_Mutex);
+		}
+
+		Samy_OS_Schedule();
+	}
+
+	// Result of the Acquiring without Blocking (if the Task Blocked , its Wake-up writes the Result)
+	if(p_Task->Task_State != Waiting)
+	{
+		p_Task->Task_Blocked_On.Wake_Up_Status = L_OS_status;
+	}
+
+	return L_OS_status;
+}
+
+static OS_Register Samy_OS_Service_Release_Mutex(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2)
+{
+	Mutex_ref *p_Mutex = (Mutex_ref*)argument_0;
+	Tasks_ref *p_Owner = MUTEX_OWNER(p_Mutex);
+	Tasks_ref *p_Next_Owner = p_Mutex->Waiting_Tasks.Head;
+
+	if((p_Owner != NULL) && (p_Owner == OS_Control.Current_Task)) // Only the Owner (the Caller of the SVC) Releases the Mutex
+	{
+		// Restore the Priority required by the Mutexes still held by the Owner (its Base Priority if none)
+		Samy_OS_Held_Mutexes_Remove(p_Owner, p_Mutex);
+		Samy_OS_Set_Task_Priority(p_Owner, Samy_OS_Get_Mutexes_Priority(p_Owner));
+
+		// The Head of the Wait Queue is the Next Owner (Highest Priority , or Longest Waiting) ===> Handed the Mutex in constant time
+		if(p_Next_Owner != NULL) // the Pending Task now Acquires the Mutex and is Readied
+		{
+			p_Mutex->Lock_Word = (OS_Register)p_Next_Owner | MUTEX_LOCK_KERNEL;
+			Samy_OS_Held_Mutexes_Insert(p_Next_Owner, p_Mutex);
+
+			// Leaving the Wait Queue Re-evaluates the New Owner Priority (Priority Ceiling , and the Remaining Waiters)
+			Samy_OS_Wake_Up_Task(p_Next_Owner, No_Error);
+		}
+		else
+		{
+			p_Mutex->Lock_Word = 0;
+		}
+
+		Samy_OS_Schedule();
+	}
+
+	return No_Error;
+}
+
+static OS_Register Samy_OS_Service_Get_Timestamp(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2)
+{
+	// The 64-Bit Timestamp doesn't fit the Return Register ===> it is written to the Caller variable
+	*(uint64*)argument_0 = Samy_OS_Read_Timestamp();
+
+	return No_Error;
+}
+
+static OS_Register Samy_OS_Service_Take_Semaphore(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2)
+{
+	Tasks_ref *p_Task = (Tasks_ref*)argument_0;
+	Semaphore_ref *p_Semaphore = (Semaphore_ref*)argument_1;
+	uint32 timeout = (uint32)argument_2;
+
+	if(p_Semaphore->Count != 0)
+	{
+		p_Semaphore->Count--;
+		p_Task->Task_Blocked_On.Wake_Up_Status = No_Error;
+	}
+	else if(timeout == 0)
+	{
+		p_Task->Task_Blocked_On.Wake_Up_Status = Wait_Timeout;
+	}
+	else
+	{
+		// Block the Task until a Give hands it a Token (No_Error) , or its timeout expires (Wait_Timeout)
+		Samy_OS_Block_Task(p_Task, &p_Semaphore->Waiting_Tasks, timeout);
+
+		Samy_OS_Schedule();
+	}
+
+	return No_Error;
+}
+
+static OS_Register Samy_OS_Service_Give_Semaphore(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2)
+{
+	Semaphore_ref *p_Semaphore = (Semaphore_ref*)argument_0;
+	Tasks_ref *p_Task = p_Semaphore->Waiting_Tasks.Head;
+	uint32 L_Max_Count = (p_Semaphore->Max_Count != 0) ? p_Semaphore->Max_Count : 0xFFFFFFFF;
+	Samy_OS_Status L_OS_status = No_Error;
+
+	if(p_Task != NULL)
+	{
+		// The Token goes directly to the Highest Priority Waiter (the Head) ===> Only this Task is Readied , in constant time
+		Samy_OS_Wake_Up_Task(p_Task, No_Error);
+
+		Samy_OS_Schedule();
+	}
+	else if(p_Semaphore->Count < L_Max_Count)
+	{
+		p_Semaphore->Count++;
+	}
+	else
+	{
+		L_OS_status = Semaphore_Count_Overflow;
+	}
+
+	return L_OS_status;
+}
+
+static OS_Register Samy_OS_Service_Notify_Task(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2)
+{
+	Tasks_ref *p_Task = (Tasks_ref*)argument_0;
+	uint32 value = (uint32)argument_1;
+
+	switch((Samy_OS_Notify_Action)argument_2)
+	{
+	case Notify_Set_Bits:
+		p_Task->Task_Notification.Value |= value;
+		break;
+
+	case Notify_Increment:
+		p_Task->Task_Notification.Value++;
+		break;
+
+	case Notify_Overwrite:
+		p_Task->Task_Notification.Value = value;
+		break;
+	}
+
+	if(p_Task->Task_Notification.State == Notification_Waiting)
+	{
+		// The Task is Blocked on its Notification ===> it Receives it now , and is Readied directly
+		Samy_OS_Receive_Notification(p_Task);
+		Samy_OS_Wake_Up_Task(p_Task, No_Error);
+
+		Samy_OS_Schedule();
+	}
+	else
+	{
+		p_Task->Task_Notification.State = Notification_Pending;
+	}
+
+	return No_Error;
+}
+
+static OS_Register Samy_OS_Service_Set_Event_Bits(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2)
+{
+	Event_Group_ref *p_Event_Group = (Event_Group_ref*)argument_0;
+
+	OS_Atomic_Set_Bits(&p_Event_Group->Event_Bits, (uint32)argument_1);
+
+	Samy_OS_Event_Group_Update(p_Event_Group);
+
+	return No_Error;
+}
+
+static OS_Register Samy_OS_Service_Wait_Event_Bits(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2)
+{
+	Tasks_ref *p_Task = (Tasks_ref*)argument_0;
+	Event_Group_ref *p_Event_Group = (Event_Group_ref*)argument_1;
+	uint32 timeout = (uint32)argument_2;
+	uint32 L_Event_Bits = p_Event_Group->Event_Bits;
+
+	if(Samy_OS_Event_Wait_Satisfied(p_Task, L_Event_Bits))
+	{
+		// Already Set ===> the Task continues without Blocking
+		if(p_Task->Task_Blocked_On.Event_Options & Event_Clear_On_Exit)
+		{
+			OS_Atomic_Clear_Bits(&p_Event_Group->Event_Bits, p_Task->Task_Blocked_On.Event_Bits);
+		}
+
+		p_Task->Task_Blocked_On.Event_Bits = L_Event_Bits;
+		p_Task->Task_Blocked_On.Wake_Up_Status = No_Error;
+	}
+	else if(timeout == 0)
+	{
+		p_Task->Task_Blocked_On.Wake_Up_Status = Wait_Timeout;
+	}
+	else
+	{
+		// Block the Task until a Setter satisfies its Wait (No_Error) , or its timeout expires (Wait_Timeout)
+		Samy_OS_Block_Task(p_Task, &p_Event_Group->Waiting_Tasks, timeout);
+
+		Samy_OS_Schedule();
+	}
+
+	return No_Error;
+}
+
+static OS_Register Samy_OS_Service_Send_Message(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2)
+{
+	Tasks_ref *p_Task = (Tasks_ref*)argument_0;
+	Message_Queue_ref *p_Message_Queue = (Message_Queue_ref*)argument_1;
+	uint32 timeout = (uint32)argument_2;
+
+	if(Samy_OS_Message_Queue_Put(p_Message_Queue, p_Task->Task_Blocked_On.p_Message) == No_Error)
+	{
+		p_Task->Task_Blocked_On.Wake_Up_Status = No_Error;
+	}
+	else if(timeout == 0)
+	{
+		p_Task->Task_Blocked_On.Wake_Up_Status = Wait_Timeout;
+	}
+	else
+	{
+		// Block the Task until a Receiver Frees a Place for its Message (No_Error) , or its timeout expires (Wait_Timeout)
+		Samy_OS_Block_Task(p_Task, &p_Message_Queue->Senders, timeout);
+
+		Samy_OS_Schedule();
+	}
+
+	return No_Error;
+}
+
+static OS_Register Samy_OS_Service_Receive_Message(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2)
+{
+	Tasks_ref *p_Task = (Tasks_ref*)argument_0;
+	Message_Queue_ref *p_Message_Queue = (Message_Queue_ref*)argument_1;
+	uint32 timeout = (uint32)argument_2;
+	Tasks_ref *p_Sender;
+
+	if(Dequeue_item(&p_Message_Queue->Messages, p_Task->Task_Blocked_On.p_Message) == QUEUE_NO_ERROR)
+	{
+		p_Task->Task_Blocked_On.Wake_Up_Status = No_Error;
+
+		// A Sender is Blocked (the Queue was Full) ===> its Message takes the Freed Place , and it is Readied
+		p_Sender = p_Message_Queue->Senders.Head;
+		if(p_Sender != NULL)
+		{
+			Enqueue_item(&p_Message_Queue->Messages, p_Sender->Task_Blocked_On.p_Message);
+			Samy_OS_Wake_Up_Task(p_Sender, No_Error);
+
+			Samy_OS_Schedule();
+		}
+	}
+	else if(timeout == 0)
+	{
+		p_Task->Task_Blocked_On.Wake_Up_Status = Wait_Timeout;
+	}
+	else
+	{
+		// Block the Task until a Sender Copies a Message to its Buffer (No_Error) , or its timeout expires (Wait_Timeout)
+		Samy_OS_Block_Task(p_Task, &p_Message_Queue->Receivers, timeout);
 
-	// Determine Current and Next Tasks
+		Samy_OS_Schedule();
+	}
+
+	return No_Error;
+}
+
+static OS_Register Samy_OS_Service_Wait_Notification(OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2)
+{
+	Tasks_ref *p_Task = (Tasks_ref*)argument_0;
+	uint32 timeout = (uint32)argument_2;
+
+	p_Task->Task_Notification.Clear_Bits_On_Exit = (uint32)argument_1;
+
+	if(p_Task->Task_Notification.State == Notification_Pending)
+	{
+		// Notified before the Wait ===> Received without Blocking
+		Samy_OS_Receive_Notification(p_Task);
+		p_Task->Task_Blocked_On.Wake_Up_Status = No_Error;
+	}
+	else if(timeout == 0)
+	{
+		p_Task->Task_Blocked_On.Wake_Up_Status = Wait_Timeout;
+	}
+	else
+	{
+		// Block the Task until a Notifier Readies it (No_Error) , or its timeout expires (Wait_Timeout)
+		p_Task->Task_Notification.State = Notification_Waiting;
+		Samy_OS_Block_Task(p_Task, NULL, timeout);
+
+		Samy_OS_Schedule();
+	}
+
+	return No_Error;
+}
+
+static void Samy_OS_Set_Task_Priority(Tasks_ref *p_Task , uint8 priority)
+{
+	Wait_Queue_ref *p_Wait_Queue = p_Task->Task_Blocked_On.p_Wait_Queue;
+	uint32 L_Remaining_Time_Slice = p_Task->Remaining_Time_Slice;
+
+	// Same Priority ===> Nothing to Re-Link (the Task keeps its Round-Robin Place)
+	if(p_Task->Task_Priority == priority)
+	{
+		return;
+	}
+
+	// Re-Link the Task in the Ready List of its New Priority (if it is Ready or Running)
+	if(p_Task->Ready_Next != NULL)
+	{
+		Samy_OS_Ready_List_Remove(p_Task);
+		p_Task->Task_Priority = priority;
+		Samy_OS_Ready_List_Insert(p_Task);
+
+		// A Priority Change is not a Yield ===> the Task becomes the Head of its New Ready List (Ahead of the Same Priority Tasks ,
+		// a Raised Mutex Owner Runs first to Release the Mutex) , and continues its Remaining Time Slice
+		Ready_List[priority] = p_Task;
+		p_Task->Remaining_Time_Slice = L_Remaining_Time_Slice;
+	}
+	// Re-Position the Task in the Priority Ordered Wait Queue it is Blocked on (if any) , to keep the Priority order
+	else if((p_Wait_Queue != NULL) && (p_Wait_Queue->Order == Wait_Queue_Priority_Order))
+	{
+		Samy_OS_Wait_Queue_Remove(p_Task);
+		p_Task->Task_Priority = priority;
+		Samy_OS_Wait_Queue_Insert(p_Wait_Queue, p_Task);
+	}
+	else
+	{
+		p_Task->Task_Priority = priority;
+	}
+}
+
+static uint8 Samy_OS_Get_Mutexes_Priority(Tasks_ref *p_Task)
+{
+	// The Highest Priority (Lowest Value) among the Base Priority of the Task and the Priorities required by its held Mutexes
+	uint8 L_Priority = p_Task->Task_Base_Priority;
+	Mutex_ref *p_Mutex = p_Task->Held_Mutexes;
+	Tasks_ref *p_Waiter;
+
+	while(p_Mutex != NULL)
+	{
+		if((p_Mutex->Mutex_Priority_Ceiling.State == Priority_Ceiling_Enabled) && (p_Mutex->Mutex_Priority_Ceiling.Ceiling_Priority < L_Priority))
+		{
+			L_Priority = p_Mutex->Mutex_Priority_Ceiling.Ceiling_Priority;
+		}
+
+		if(p_Mutex->Mutex_Priority_Inheritance == Priority_Inheritance_Enabled)
+		{
+			// The Head is the Highest Priority Waiter , unless the Wait Queue is in FIFO order
+			p_Waiter = p_Mutex->Waiting_Tasks.Head;
+			while(p_Waiter != NULL)
+			{
+				if(p_Waiter->Task_Priority < L_Priority)
+				{
+					L_Priority = p_Waiter->Task_Priority;
+				}
+				p_Waiter = (p_Mutex->Waiting_Tasks.Order == Wait_Queue_FIFO_Order) ? p_Waiter->Task_Blocked_On.Next : NULL;
+			}
+		}
+
+		p_Mutex = p_Mutex->Next_Held;
+	}
+
+	return L_Priority;
+}
+
+static void Samy_OS_Mutex_Owners_Update(Mutex_ref *p_Mutex)
+{
+	/*
+		Transitive Priority Inheritance: the Owner of the Mutex gets its New Priority , and if it is Blocked on another Mutex
+		(Re-Positioned in its Wait Queue by Samy_OS_Set_Task_Priority) , the Owner of that Mutex is Updated too ... until
+		an Owner keeps its Priority (the Rest of the Chain is not affected)
+	*/
+	Tasks_ref *p_Owner;
+	uint8 L_Priority;
+
+	while((p_Mutex != NULL) && (MUTEX_OWNER(p_Mutex) != NULL))
+	{
+		p_Owner = MUTEX_OWNER(p_Mutex);
+		L_Priority = Samy_OS_Get_Mutexes_Priority(p_Owner);
+
+		if(L_Priority == p_Owner->Task_Priority)
+		{
+			break;
+		}
+
+		Samy_OS_Set_Task_Priority(p_Owner, L_Priority);
+		p_Mutex = p_Owner->Task_Blocked_On.p_Mutex;
+	}
+}
+
+static void Samy_OS_Held_Mutexes_Insert(Tasks_ref *p_Task , Mutex_ref *p_Mutex)
+{
+	// Only the Mutexes managed by the OS (MUTEX_LOCK_KERNEL) are Linked: the others don't affect the Priority of their Owner
+	p_Mutex->Next_Held = p_Task->Held_Mutexes;
+	p_Task->Held_Mutexes = p_Mutex;
+}
+
+static void Samy_OS_Held_Mutexes_Remove(Tasks_ref *p_Task , Mutex_ref *p_Mutex)
+{
+	// The Mutexes are mostly Released in the reverse order of Acquiring ===> the Released Mutex is usually the Head
+	Mutex_ref **pp_Link = &p_Task->Held_Mutexes;
+
+	while((*pp_Link != NULL) && (*pp_Link != p_Mutex))
+	{
+		pp_Link = &(*pp_Link)->Next_Held;
+	}
+
+	if(*pp_Link != NULL)
+	{
+		*pp_Link = p_Mutex->Next_Held;
+	}
+
+	p_Mutex->Next_Held = NULL;
+}
+
+static void Samy_OS_Schedule(void)
+{
+	// If OS is in running state -> Decide what next task
+	// (Before Starting the OS , the Tasks are only Linked in the Ready Lists , and the First Decision is taken by the Systick)
+	if(OS_Control.OS_Mode_ID == OS_Running)
+	{
+		Samy_OS_Decide_Next_Task();
+
+		// =====> CONTEXT SWITCHING <===== (Only if the Next Task differs from the Running Task)
+		if(OS_Control.Next_Task != NULL)
+		{
+			Trigger_OS_PendSV(); // Macro for Triggering PendSV Exceptional Interrupt
+		}
+	}
+}
+
+/****************************************************************************************************************************/
+
+
+/*
+	This API (Samy_OS_SVC_Services) executes specific OS Services , Branched by the SVC_Handler Exceptional Interrupt.
+	REMARK:
+	------
+	We didn't put this Code in the SVC_Handler
+	===> to Abstract the Processor Architecture (Vector table) or the MCAL Layer (which is found in the CortexMX_OS_Porting.c)
+		 with the OS Layer
+*/
+void Samy_OS_SVC_Services(OS_Register *StackFrame_ptr)
+{
+	/*
+		The Service Number and its Arguments are extracted from the Stacked Frame (See OS_SVC_Call in CortexMX_OS_Porting.h) ,
+		This is done by starting from R0 which is the default argument , which is holding the stack frame pointer,
+		So ===> R0 ===> Argument 0 ===> StackFrame_ptr
+		Stack Frame:
+		-----------
+		* xPSR
+		* PC
+		* LR
+		* R12 <======== StackFrame_ptr[4] ===> Service Number
+		* R3
+		* R2  <======== StackFrame_ptr[2] ===> Argument 2
+		* R1  <======== StackFrame_ptr[1] ===> Argument 1
+		* R0  <======== StackFrame_ptr[0] ===> Argument 0 , and the Return Value of the Service
+
+		The Service is Dispatched through the OS Services Table in constant time ,
+		and each Service does only its own work (Scheduling only when the Ready Tasks changed)
+	*/
+	uint32 SVC_Number = (uint32)StackFrame_ptr[4];
+
+	if(SVC_Number < SVC_Services_Num)
+	{
+		StackFrame_ptr[0] = SVC_Services_Table[SVC_Number](StackFrame_ptr[0], StackFrame_ptr[1], StackFrame_ptr[2]);
+	}
+}
+
+void SysTick_Handler()
+{
+	uint32 L_Elapsed_Ticks = 1;
+	uint32 L_Interrupts_State;
+
+	// The Systick has the Lowest Priority ===> Masking the Interrupts keeps the OS Structures consistent
+	// for the Interrupts calling the OS (Samy_OS_Give_Semaphore_From_ISR)
+	OS_ENTER_CRITICAL(L_Interrupts_State);
+
+#if OS_TICKLESS_IDLE
+	if(Ticker_Realign() == 0)
+	{
+		// The Mid-Period Interrupt Realigning the Periodic Tick after a Tickless Idle period ===> Not a Tick
+		OS_EXIT_CRITICAL(L_Interrupts_State);
+		return;
+	}
+#endif
+
+	SysTick_LED ^= 1;
+
+#if OS_TICKLESS_IDLE
+	if(Tickless_Idle_Active == 1)
+	{
+		// Woken-up from the Tickless Idle ===> Credit all the Suppressed ticks in one step
+		Tickless_Idle_Active = 0;
+		L_Elapsed_Ticks = Ticker_Resume();
+	}
+#endif
+
+#if OS_TICK_HOOK
+	Samy_OS_Tick_Hook(L_Elapsed_Ticks);
+#endif
+
+	Samy_OS_Update_Tasks_Waiting_Time(L_Elapsed_Ticks);
+
+	// Round-Robin between the Same Priority Tasks , then Determine Current and Next Tasks
+	Samy_OS_Round_Robin_Rotate();
 	Samy_OS_Decide_Next_Task();
 
-	//Context Switching
-	Trigger_OS_PendSV();
+	//Context Switching (Only if the Next Task differs from the Running Task)
+	if(OS_Control.Next_Task != NULL)
+	{
+		Trigger_OS_PendSV();
+	}
+
+	OS_EXIT_CRITICAL(L_Interrupts_State);
 }
 
 
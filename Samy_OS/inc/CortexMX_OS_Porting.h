@@ -17,11 +17,41 @@ extern uint32 _eheap;
 
 #define MAIN_Stack_SIZE		3072 // 3Kb * 1024 = 3072 Bytes
 
+#define OS_TICK_PERIOD_CYCLES	8000 // CPU 8MHz ===> 8000 Count = 1msec Tick
+
+// Maximum number of ticks the Systick can be suppressed (24-Bit Reload Register)
+#define OS_TICKLESS_MAX_TICKS	((SysTick_LOAD_RELOAD_Msk + 1) / OS_TICK_PERIOD_CYCLES)
+
+
+typedef uint32 OS_Register; // Width of a CPU Register / Address (SVC Arguments/Return Value , the Stacked Frame and the Stacks Boundaries)
 
 /********************************************* OS Macros *********************************************/
 
 #define Trigger_OS_PendSV() (SCB->ICSR |= SCB_ICSR_PENDSVSET_Msk)
 
+/*
+	OS System Call ABI:
+	------------------
+	* R12       ===> Service Number (Index in the OS Services Table)
+	* R0,R1,R2  ===> Service Arguments
+	* R0        ===> Service Return Value (Written back by the OS in the Stacked R0)
+	All of them are found in the Stacked Frame by the SVC_Handler , So a Single "SVC #0" serves all the OS Services.
+*/
+static inline OS_Register OS_SVC_Call(uint32 service_id , OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2)
+{
+	register OS_Register R0 __asm("r0") = argument_0;
+	register OS_Register R1 __asm("r1") = argument_1;
+	register OS_Register R2 __asm("r2") = argument_2;
+	register uint32 R12 __asm("r12") = service_id;
+
+	__asm volatile("SVC #0" : "+r" (R0) : "r" (R1), "r" (R2), "r" (R12) : "memory");
+
+	return R0;
+}
+
+// Count Leading Zeros (single CLZ instruction on Cortex-M3) , used by the Scheduler to search the Ready Bitmap
+#define OS_COUNT_LEADING_ZEROS(value)	__CLZ(value)
+
 
 #define OS_SET_PSP(address)		__asm volatile("MOV R0,%0  \n\t   MSR PSP,R0"  :   :"r" (address))
 #define OS_GET_PSP(address)		__asm volatile("MRS R0,PSP  \n\t   MOV %0,R0"  : "=r" (address))
@@ -32,10 +62,84 @@ extern uint32 _eheap;
 #define Switch_CPU_Access_Level_to_Privileged()	 	__asm("MRS R0,CONTROL \n\t   AND R0,R0,#0xFFFFFFFE \n\t MSR CONTROL,R0")
 #define Switch_CPU_Access_Level_to_Unprivileged() 	__asm("MRS R0,CONTROL  \n\t  ORR R0,R0,#0x1         \n\t MSR CONTROL,R0")
 
+#define OS_WAIT_FOR_EVENT()		__asm volatile("WFE") // Processor Enters Sleep Mode until an Event/Interrupt
+
+// Handler Mode , or Privileged Thread Mode (CONTROL.nPRIV = 0) ===> the System Control Space (Systick , SCB) is Accessible
+#define OS_IS_PRIVILEGED()		((__get_IPSR() != 0) || ((__get_CONTROL() & 0x1) == 0))
+
+// Short Critical Sections of the OS: Masks all the Configurable Interrupts , then Restores the Previous Mask (Nesting is allowed)
+#define OS_ENTER_CRITICAL(state)	do{ (state) = __get_PRIMASK(); __disable_irq(); }while(0)
+#define OS_EXIT_CRITICAL(state)		__set_PRIMASK(state)
+
+/*
+	Bit-Band Alias of the SRAM (0x20000000 - 0x200FFFFF) ===> 0x22000000 + (Byte Offset * 32) + (Bit Number * 4)
+	Each Bit has its own Alias Word , So a Single Store Sets/Clears the Bit atomically (No Read-Modify-Write can be Interrupted)
+*/
+#define OS_BIT_BAND_SRAM(address , bit)	(*(vuint32*)(0x22000000UL + (((uint32)(address) - 0x20000000UL) * 32) + ((bit) * 4)))
+
+// Atomic Set/Clear of the Bits of a Word in the SRAM , without Masking the Interrupts (One Bit-Band Store per Bit)
+static inline void OS_Atomic_Set_Bits(vuint32 *p_Word , uint32 bits)
+{
+	uint32 L_Bit;
+
+	while(bits != 0)
+	{
+		L_Bit = 31 - __CLZ(bits);
+		OS_BIT_BAND_SRAM(p_Word, L_Bit) = 1;
+		bits &= ~(1UL << L_Bit);
+	}
+}
+
+static inline void OS_Atomic_Clear_Bits(vuint32 *p_Word , uint32 bits)
+{
+	uint32 L_Bit;
+
+	while(bits != 0)
+	{
+		L_Bit = 31 - __CLZ(bits);
+		OS_BIT_BAND_SRAM(p_Word, L_Bit) = 0;
+		bits &= ~(1UL << L_Bit);
+	}
+}
+
+/*
+	Lock-Free Updates (LDREX/STREX): the Exclusive Store fails if the Word was Stored by someone else , or an Exception
+	Entry/Return happened since the Exclusive Load (the Local Monitor is Cleared) ===> the Caller Reloads and Retries.
+*/
+static inline uint8 OS_Atomic_Compare_Exchange(vuint32 *p_Word , uint32 expected , uint32 desired)
+{
+	uint8 L_Exchanged = 0;
+
+	if(__LDREXW((volatile uint32_t*)p_Word) == expected)
+	{
+		L_Exchanged = (__STREXW(desired, (volatile uint32_t*)p_Word) == 0);
+	}
+	else
+	{
+		__CLREX(); // Releases the Exclusive Access
+	}
+
+	return L_Exchanged;
+}
+
+// The Memory Accesses before it complete before the ones after it (Publishing an Item before its Index)
+#define OS_MEMORY_BARRIER()		__DMB()
+
 /************************************************************************************************/
 
 void HW_Init(void);
 void Start_Ticker(void);
 
+// Builds the Initial Task Frame at the Top of the Task Stack , and returns the Initial PSP of the Task
+uint32* Stack_Frame_Init(uint32 *p_Stack_Top , void (*pf_Task_Entry)(void));
+
+// Tickless Idle Support
+uint8 Ticker_Suppress(uint32 ticks); // The Next Systick Interrupt fires after "ticks" from the last Tick , instead of the Next 1msec (0 ===> Not Suppressed , a Systick is already Pending)
+uint32 Ticker_Resume(void);		 	// Restores the Periodic Tick (Keeping its Phase) , and returns the number of Complete ticks elapsed since the last Tick
+uint8 Ticker_Realign(void);		 	// Called by every Systick Interrupt , returns 0 for the Mid-Period Interrupt Realigning the Tick after Ticker_Resume (Not a Tick)
+
+// Cycles elapsed since the last Tick credited to the OS (Including a Pending Systick , or a Suppressed Period)
+uint32 Ticker_Get_Elapsed_Cycles(void);
+
 
 #endif /* CORTEXMX_OS_PORTING_H_ */
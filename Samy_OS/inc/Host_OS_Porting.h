@@ -0,0 +1,108 @@
+/*
+ * Host_OS_Porting.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Youssef Samy
+ */
+
+/*
+	Linux (POSIX) Simulation of the Porting Layer (Same contract as CortexMX_OS_Porting.h)
+	---------------------------------------------------------------------------------
+	* Each Task runs on its own ucontext , and PendSV_Handler switches between them (swapcontext)
+	* SysTick  ===> SIGALRM of a 1msec Interval Timer (setitimer)
+	* SVC      ===> OS_SVC_Call builds the Stacked Frame and calls Samy_OS_SVC_Services with the Interrupts Signals Masked
+	* IRQs     ===> SIGUSR1 , SIGUSR2 (Host_Trigger_IRQ) , Running the Handlers given to Host_IRQ_Init
+	* PendSV   ===> Trigger_OS_PendSV only marks it Pending , it is executed when the SVC/SysTick/IRQ "returns"
+	So Scheduler.c , Samy_OS_FIFO.c and the Application Tasks are built unmodified as a Linux Process:
+
+	gcc -DOS_HOST_PORT -ISamy_OS/inc Src/main.c Samy_OS/Scheduler.c Samy_OS/Samy_OS_FIFO.c \
+	    Samy_OS/Samy_String_Library.c Samy_OS/Host_OS_Porting.c -o Samy_OS_Host
+*/
+
+#ifndef HOST_OS_PORTING_H_
+#define HOST_OS_PORTING_H_
+
+#include "Platform_Types.h"
+
+typedef unsigned long OS_Register; // Width of a CPU Register / Address (Pointer Width of the Host)
+
+// Simulated RAM , for the Stacks Boundaries calculated by the OS (The Tasks run on their own Host Stacks)
+#define HOST_RAM_SIZE			(64 * 1024)
+extern uint32 Host_RAM[HOST_RAM_SIZE / 4];
+
+#define _estack					(Host_RAM[HOST_RAM_SIZE / 4])
+#define _eheap					(Host_RAM[0])
+
+#define MAIN_Stack_SIZE			3072
+
+#define HOST_TASK_STACK_SIZE	(64 * 1024) // Real Stack of each Task (Signal Handlers and the C Library need more than the Target Stacks)
+
+#define OS_TICK_PERIOD_CYCLES	1000000 // Timestamp Units per Tick: 1msec Tick = 1000000 nano-seconds
+
+#define OS_TICKLESS_MAX_TICKS	1000
+
+
+/********************************************* OS Macros *********************************************/
+
+extern vuint32 Host_PendSV_Pending;
+
+#define Trigger_OS_PendSV()		(Host_PendSV_Pending = 1)
+
+OS_Register OS_SVC_Call(uint32 service_id , OS_Register argument_0 , OS_Register argument_1 , OS_Register argument_2);
+
+#define OS_COUNT_LEADING_ZEROS(value)	(((value) == 0) ? 32 : __builtin_clz(value))
+
+// The Host Process has a Single Stack Pointer and Access Level
+#define OS_SET_PSP(address)		((void)(address))
+#define OS_GET_PSP(address)		((void)(address))
+
+#define OS_SWITCH_SP_to_PSP()
+#define OS_SWITCH_SP_to_MSP()
+
+#define Switch_CPU_Access_Level_to_Privileged()
+#define Switch_CPU_Access_Level_to_Unprivileged()
+
+#define OS_WAIT_FOR_EVENT()		Host_Wait_For_Event() // Process Sleeps until the Next Signal
+
+#define OS_IS_PRIVILEGED()		1
+
+// The Interrupts (SysTick and IRQs Signals) don't Preempt each other , nor the OS Services (Masked during the SVC)
+#define OS_ENTER_CRITICAL(state)	((state) = 0)
+#define OS_EXIT_CRITICAL(state)		((void)(state))
+
+// Atomic Set/Clear of the Bits of a Word (the Cortex-M3 Port uses the Bit-Band Alias)
+#define OS_Atomic_Set_Bits(p_Word , bits)		((void)__atomic_fetch_or((p_Word), (bits), __ATOMIC_SEQ_CST))
+#define OS_Atomic_Clear_Bits(p_Word , bits)		((void)__atomic_fetch_and((p_Word), ~(bits), __ATOMIC_SEQ_CST))
+
+// Lock-Free Updates (the Cortex-M3 Port uses LDREX/STREX) , Returns 1 if the Word (32-Bit , or OS_Register) was Exchanged
+#define OS_Atomic_Compare_Exchange(p_Word , expected , desired)		\
+	({ __typeof__(+*(p_Word)) L_Expected = (expected); (uint8)__atomic_compare_exchange_n((p_Word), &L_Expected, (desired), 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST); })
+
+#define OS_MEMORY_BARRIER()		__atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+/************************************************************************************************/
+
+void HW_Init(void);
+void Start_Ticker(void);
+
+// Creates the ucontext of the Task , and returns it as the Initial "PSP" of the Task
+uint32* Stack_Frame_Init(uint32 *p_Stack_Top , void (*pf_Task_Entry)(void));
+
+// Tickless Idle Support
+uint8 Ticker_Suppress(uint32 ticks); // Returns 0 (Not Suppressed) if a SysTick Signal is already Pending
+uint32 Ticker_Resume(void);
+uint8 Ticker_Realign(void); // Always 1 (the Host Timer restarts a Complete Period , No Mid-Period Signal)
+
+// Nano-seconds elapsed since the last Tick credited to the OS
+uint32 Ticker_Get_Elapsed_Cycles(void);
+
+void Host_Wait_For_Event(void);
+
+// Simulated Peripheral Interrupts (the From_ISR APIs can be called by their Handlers)
+#define HOST_IRQS_NUM			2
+
+void Host_IRQ_Init(uint32 irq_number , void (*pf_IRQ_Handler)(void));
+void Host_Trigger_IRQ(uint32 irq_number); // Pends the IRQ: it runs immediately , or when the SVC/SysTick/IRQ in progress returns
+
+
+#endif /* HOST_OS_PORTING_H_ */
@@ -27,6 +27,8 @@ typedef volatile unsigned long long int   vuint64;
 typedef float 		float32;
 typedef double 		float64;
 
+#ifndef NULL
 #define NULL ((void*)0)
+#endif
 
 #endif /* PLATFORM_TYPES_H_ */
@@ -8,18 +8,28 @@
 #ifndef SAMY_OS_FIFO_H_
 #define SAMY_OS_FIFO_H_
 
-#include "Scheduler.h"
+#include "Platform_Types.h"
+#include "Samy_String_Library.h"
 
 
-#define element_type    Tasks_ref*
+/*
+	Ring Buffers:
+	------------
+	The length is a Power of 2 , and head/tail are Free-Running Indices (Only Incremented , Wrapping at 2^32):
+	* Count = tail - head   ===> Empty: tail == head , Full: tail - head == length (No separate count , No ambiguity)
+	* Place = Index & (length - 1) ===> a Single AND instead of Comparing/Resetting Pointers on every Operation
 
+	1- FIFO_BUFF   : the Item Size is given at the Initialization (QUEUE_init) , Items are Copied by Value (e.g. the OS Message Queues)
+	2- FIFO_DEFINE : Typed Ring , the Item Type and the length are chosen at Compile time (Items are Assigned , Indexing is Scaled by the Compiler)
+*/
 typedef struct
 {
-	uint32 length;
-	uint32 count;
-	element_type *base;
-	element_type *head;
-	element_type *tail;
+	uint32 length;			// Maximum Number of Items (Power of 2)
+	uint32 mask;			// length - 1
+	uint32 element_size;	// Size of each Item in Bytes
+	uint8 *base;
+	uint32 head;			// Index of the Oldest Item (Next to be Dequeued)
+	uint32 tail;			// Index of the Next Enqueued Item
 
 }FIFO_BUFF;
 
@@ -31,11 +41,59 @@ typedef enum
 	QUEUE_NULL            // FIFO Buffer does not exist
 }FIFO_STATUS;
 
-FIFO_STATUS QUEUE_init(FIFO_BUFF *buffer , element_type *ptr_arr , uint32 length);
-FIFO_STATUS Enqueue_item(FIFO_BUFF *buffer , element_type item);
-FIFO_STATUS Dequeue_item(FIFO_BUFF *buffer , element_type *ptr_item);
+#define FIFO_IS_POWER_OF_2(length)	(((length) != 0) && (((length) & ((length) - 1)) == 0))
+
+FIFO_STATUS QUEUE_init(FIFO_BUFF *buffer , void *ptr_arr , uint32 length , uint32 element_size);
+FIFO_STATUS Enqueue_item(FIFO_BUFF *buffer , const void *ptr_item);
+FIFO_STATUS Dequeue_item(FIFO_BUFF *buffer , void *ptr_item);
 FIFO_STATUS Is_Queue_Full(FIFO_BUFF *buffer);
 FIFO_STATUS Is_Queue_Empty(FIFO_BUFF *buffer);
+uint32 Queue_Count(FIFO_BUFF *buffer);
+
+
+/*
+	Typed Ring: FIFO_DEFINE(Samples_FIFO , uint16 , 64) defines
+	* Samples_FIFO_t                                   ===> the Ring Type (Zero-Initialized ===> Empty)
+	* Samples_FIFO_Enqueue(Samples_FIFO_t* , uint16)   ===> QUEUE_NO_ERROR or QUEUE_FULL
+	* Samples_FIFO_Dequeue(Samples_FIFO_t* , uint16*)  ===> QUEUE_NO_ERROR or QUEUE_EMPTY
+	* Samples_FIFO_Count(Samples_FIFO_t*)
+*/
+#define FIFO_DEFINE(name , item_type , length)																\
+	_Static_assert(FIFO_IS_POWER_OF_2(length), #name " length must be a Power of 2");						\
+																											\
+	typedef struct																							\
+	{																										\
+		uint32 head;																						\
+		uint32 tail;																						\
+		item_type items[length];																			\
+	}name##_t;																								\
+																											\
+	static inline FIFO_STATUS name##_Enqueue(name##_t *buffer , item_type item)								\
+	{																										\
+		if((buffer->tail - buffer->head) == (length))														\
+		{																									\
+			return QUEUE_FULL;																				\
+		}																									\
+		buffer->items[buffer->tail & ((length) - 1)] = item;												\
+		buffer->tail++;																						\
+		return QUEUE_NO_ERROR;																				\
+	}																										\
+																											\
+	static inline FIFO_STATUS name##_Dequeue(name##_t *buffer , item_type *ptr_item)						\
+	{																										\
+		if(buffer->tail == buffer->head)																	\
+		{																									\
+			return QUEUE_EMPTY;																				\
+		}																									\
+		*ptr_item = buffer->items[buffer->head & ((length) - 1)];											\
+		buffer->head++;																						\
+		return QUEUE_NO_ERROR;																				\
+	}																										\
+																											\
+	static inline uint32 name##_Count(name##_t *buffer)														\
+	{																										\
+		return buffer->tail - buffer->head;																	\
+	}
 
 
 
@@ -0,0 +1,228 @@
+/*
+ * Samy_OS_Lock_Free_FIFO.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Youssef Samy
+ */
+
+#ifndef SAMY_OS_LOCK_FREE_FIFO_H_
+#define SAMY_OS_LOCK_FREE_FIFO_H_
+
+#include "Scheduler.h"
+
+
+/*
+	Lock-Free Typed Rings (ISRs ===> Task Data Streams):
+	---------------------------------------------------
+	Same Power of 2 length and Free-Running Indices as FIFO_DEFINE (Samy_OS_FIFO.h) , but the Producers (Interrupt Handlers)
+	and the Consumer (One Task) access the Ring Concurrently without Masking the Interrupts and without any SVC:
+	1- SPSC_FIFO_DEFINE : Single Producer  ===> Wait-Free , each side Writes only its own Index (head: Consumer , tail: Producer)
+	2- MPSC_FIFO_DEFINE : Multiple Producers (Nested Interrupts) ===> Lock-Free , a Producer Reserves its Place by
+	                      Incrementing the tail with LDREX/STREX (OS_Atomic_Compare_Exchange) , and Publishes the Item
+	                      through the Sequence of its Slot. A Preempted Producer never Blocks the others (No Spinning on
+	                      each other) , the Consumer just stops at its Unpublished Slot until it is Published.
+
+	Optional Wake-up: if p_Consumer is given at the Init , the Producer Notifies the Consumer Task (Samy_OS_Notify_Task_From_ISR)
+	only when the Ring goes Non-Empty (the Consumer is Waiting on the Published Item) ===> a Short Critical Section once per Burst ,
+	never per Item. With p_Consumer = NULL there is no Critical Section at all (the Consumer Polls the Ring).
+	Note: the Consumer Task's Notification is reserved for its Ring (Dequeue_Wait Clears its Notification Value).
+
+	SPSC_FIFO_DEFINE(ADC_Stream , uint16 , 64) / MPSC_FIFO_DEFINE(ADC_Stream , uint16 , 64) define
+	* ADC_Stream_t                                                 ===> the Ring Type
+	* ADC_Stream_Init(ADC_Stream_t* , Tasks_ref *p_Consumer)       ===> Empty Ring , p_Consumer may be NULL (No Wake-up)
+	* ADC_Stream_Enqueue_From_ISR(ADC_Stream_t* , uint16)          ===> QUEUE_NO_ERROR or QUEUE_FULL (Producers)
+	* ADC_Stream_Dequeue(ADC_Stream_t* , uint16*)                  ===> QUEUE_NO_ERROR or QUEUE_EMPTY (Consumer)
+	* ADC_Stream_Dequeue_Wait(ADC_Stream_t* , uint16* , timeout)   ===> Blocks the Consumer while the Ring is Empty ,
+	                                                                    QUEUE_EMPTY if the timeout expires (Needs p_Consumer)
+*/
+
+
+// Notifies the Consumer if it was Waiting on the Item just Published (head == Index of the Item)
+static inline void Lock_Free_FIFO_Wake_Up(Tasks_ref *p_Consumer , uint32 head , uint32 index)
+{
+	if((p_Consumer != NULL) && (head == index))
+	{
+		Samy_OS_Notify_Task_From_ISR(p_Consumer, 0, Notify_Increment);
+	}
+}
+
+// Ticks Remaining until the Deadline of a Dequeue_Wait (OS_WAIT_FOREVER never expires)
+static inline uint32 Lock_Free_FIFO_Remaining_Ticks(uint64 deadline , uint32 timeout)
+{
+	uint64 L_Now;
+
+	if(timeout == OS_WAIT_FOREVER)
+	{
+		return OS_WAIT_FOREVER;
+	}
+
+	L_Now = Samy_OS_Get_Tick_Count();
+
+	return (L_Now < deadline) ? (uint32)(deadline - L_Now) : 0;
+}
+
+// Dequeues , or Waits for the Notification of the Producers (Called by the Consumer Task only)
+#define LOCK_FREE_FIFO_DEQUEUE_WAIT(name , item_type)																\
+	static inline FIFO_STATUS name##_Dequeue_Wait(name##_t *buffer , item_type *ptr_item , uint32 timeout)		\
+	{																										\
+		FIFO_STATUS L_Status;																				\
+		uint64 L_Deadline = Samy_OS_Get_Tick_Count() + timeout;												\
+		uint32 L_Remaining_Ticks = timeout;																	\
+																											\
+		/* the Ring is Checked again after every Notification (a Notification may be older than the last Dequeue) ,	\
+		   and the Next Wait gets only the ticks Remaining until the Deadline */							\
+		while(((L_Status = name##_Dequeue(buffer, ptr_item)) == QUEUE_EMPTY) && (buffer->p_Consumer != NULL) &&		\
+				(Samy_OS_Wait_Notification(buffer->p_Consumer, 0xFFFFFFFF, NULL, L_Remaining_Ticks) == No_Error))	\
+		{																									\
+			L_Remaining_Ticks = Lock_Free_FIFO_Remaining_Ticks(L_Deadline, timeout);						\
+		}																									\
+																											\
+		return L_Status;																					\
+	}
+
+
+#define SPSC_FIFO_DEFINE(name , item_type , length)															\
+	_Static_assert(FIFO_IS_POWER_OF_2(length), #name " length must be a Power of 2");						\
+																											\
+	typedef struct																							\
+	{																										\
+		vuint32 head;				/* Written by the Consumer only */										\
+		vuint32 tail;				/* Written by the Producer only */										\
+		Tasks_ref *p_Consumer;		/* Notified when the Ring goes Non-Empty (NULL ===> No Wake-up) */		\
+		item_type items[length];																			\
+	}name##_t;																								\
+																											\
+	static inline void name##_Init(name##_t *buffer , Tasks_ref *p_Consumer)								\
+	{																										\
+		buffer->head = 0;																					\
+		buffer->tail = 0;																					\
+		buffer->p_Consumer = p_Consumer;																	\
+	}																										\
+																											\
+	static inline FIFO_STATUS name##_Enqueue_From_ISR(name##_t *buffer , item_type item)					\
+	{																										\
+		uint32 L_Tail = buffer->tail;																		\
+																											\
+		if((L_Tail - buffer->head) == (length))																\
+		{																									\
+			return QUEUE_FULL;																				\
+		}																									\
+		buffer->items[L_Tail & ((length) - 1)] = item;														\
+		OS_MEMORY_BARRIER(); /* the Item is Written before it is Published */								\
+		buffer->tail = L_Tail + 1;																			\
+																											\
+		Lock_Free_FIFO_Wake_Up(buffer->p_Consumer, buffer->head, L_Tail);									\
+		return QUEUE_NO_ERROR;																				\
+	}																										\
+																											\
+	static inline FIFO_STATUS name##_Dequeue(name##_t *buffer , item_type *ptr_item)								\
+	{																										\
+		uint32 L_Head = buffer->head;																		\
+																											\
+		if(buffer->tail == L_Head)																			\
+		{																									\
+			return QUEUE_EMPTY;																				\
+		}																									\
+		OS_MEMORY_BARRIER(); /* the Item is Read after its Publishing is Seen */							\
+		*ptr_item = buffer->items[L_Head & ((length) - 1)];										\
+		OS_MEMORY_BARRIER(); /* the Item is Read before its Place is Freed */								\
+		buffer->head = L_Head + 1;																			\
+		return QUEUE_NO_ERROR;																				\
+	}																										\
+																											\
+	LOCK_FREE_FIFO_DEQUEUE_WAIT(name , item_type)																	\
+																											\
+	static inline uint32 name##_Count(name##_t *buffer)														\
+	{																										\
+		return buffer->tail - buffer->head;																	\
+	}
+
+
+/*
+	MPSC Slot Sequence (the Slot of the Index i):
+	* Sequence == i                 ===> Free for the Producer of the Index i
+	* Sequence == i + 1             ===> the Item of the Index i is Published (Ready for the Consumer)
+	* Sequence == i + length        ===> Consumed , Free for the Producer of the Next Lap (Index i + length)
+*/
+#define MPSC_FIFO_DEFINE(name , item_type , length)															\
+	_Static_assert(FIFO_IS_POWER_OF_2(length), #name " length must be a Power of 2");						\
+																											\
+	typedef struct																							\
+	{																										\
+		vuint32 head;				/* Written by the Consumer only */										\
+		vuint32 tail;				/* Reserved by the Producers (OS_Atomic_Compare_Exchange) */			\
+		Tasks_ref *p_Consumer;		/* Notified when the Ring goes Non-Empty (NULL ===> No Wake-up) */		\
+		struct																								\
+		{																									\
+			vuint32 sequence;																				\
+			item_type item;																					\
+		}slots[length];																						\
+	}name##_t;																								\
+																											\
+	static inline void name##_Init(name##_t *buffer , Tasks_ref *p_Consumer)								\
+	{																										\
+		uint32 i;																							\
+																											\
+		for(i = 0 ; i < (length) ; i++)																		\
+		{																									\
+			buffer->slots[i].sequence = i;																	\
+		}																									\
+		buffer->head = 0;																					\
+		buffer->tail = 0;																					\
+		buffer->p_Consumer = p_Consumer;																	\
+	}																										\
+																											\
+	static inline FIFO_STATUS name##_Enqueue_From_ISR(name##_t *buffer , item_type item)					\
+	{																										\
+		uint32 L_Tail = buffer->tail;																		\
+		sint32 L_Diff;																						\
+																											\
+		/* Reserve the Index: Retried only if another Producer (a Nested Interrupt) took it meanwhile */	\
+		while(1)																							\
+		{																									\
+			L_Diff = (sint32)(buffer->slots[L_Tail & ((length) - 1)].sequence - L_Tail);					\
+			if(L_Diff < 0)																					\
+			{																								\
+				return QUEUE_FULL; /* the Slot still holds the Item of the Previous Lap */					\
+			}																								\
+			if((L_Diff == 0) && (OS_Atomic_Compare_Exchange(&buffer->tail, L_Tail, L_Tail + 1) != 0))		\
+			{																								\
+				break;																						\
+			}																								\
+			L_Tail = buffer->tail;																			\
+		}																									\
+																											\
+		buffer->slots[L_Tail & ((length) - 1)].item = item;													\
+		OS_MEMORY_BARRIER(); /* the Item is Written before it is Published */								\
+		buffer->slots[L_Tail & ((length) - 1)].sequence = L_Tail + 1;										\
+																											\
+		Lock_Free_FIFO_Wake_Up(buffer->p_Consumer, buffer->head, L_Tail);									\
+		return QUEUE_NO_ERROR;																				\
+	}																										\
+																											\
+	static inline FIFO_STATUS name##_Dequeue(name##_t *buffer , item_type *ptr_item)								\
+	{																										\
+		uint32 L_Head = buffer->head;																		\
+																											\
+		if(buffer->slots[L_Head & ((length) - 1)].sequence != (L_Head + 1))									\
+		{																									\
+			return QUEUE_EMPTY; /* Empty , or the Oldest Item is not Published yet */						\
+		}																									\
+		OS_MEMORY_BARRIER(); /* the Item is Read after its Publishing is Seen */							\
+		*ptr_item = buffer->slots[L_Head & ((length) - 1)].item;								\
+		OS_MEMORY_BARRIER(); /* the Item is Read before its Slot is Freed */								\
+		buffer->slots[L_Head & ((length) - 1)].sequence = L_Head + (length);								\
+		buffer->head = L_Head + 1;																			\
+		return QUEUE_NO_ERROR;																				\
+	}																										\
+																											\
+	LOCK_FREE_FIFO_DEQUEUE_WAIT(name , item_type)																	\
+																											\
+	static inline uint32 name##_Count(name##_t *buffer)														\
+	{																										\
+		return buffer->tail - buffer->head; /* Including the Reserved Items not Published yet */			\
+	}
+
+
+
+#endif /* SAMY_OS_LOCK_FREE_FIFO_H_ */
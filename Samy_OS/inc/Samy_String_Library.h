@@ -31,6 +31,8 @@ uint32 String_to_Integer(uint8 *ptr); // EX: "120KG" ==> 120  , "Cost is 30" ==>
 
 uint32 String_Compare(uint8 *ptr1 , uint8 *ptr2);
 
+void Memory_Copy(uint8 *ptr1 , const uint8 *ptr2 , uint32 size); // Copies "size" Bytes from ptr2 to ptr1 (Not Terminated by '\0')
+
 /*
 	String_Compare function compares two strings and produces one of three results:
 	1- if the two string are identical it gives 0
@@ -9,31 +9,105 @@
 #define SCHEDULER_H_
 
 
+#ifdef OS_HOST_PORT
+#include "Host_OS_Porting.h" // Linux Simulation of the Porting Layer (Host_OS_Porting.c is built instead of CortexMX_OS_Porting.c)
+#else
 #include "CortexMX_OS_Porting.h"
+#endif
 #include "Samy_String_Library.h"
+#include "Samy_OS_FIFO.h"
 
 #define 	MAX_TASKS_NUM		100
 
+#define 	OS_PRIORITY_LEVELS	256 // Task_Priority is uint8 , (0 is the Highest Priority , 255 is the Lowest Priority "Idle Task")
+#define 	OS_PRIORITY_GROUPS	(OS_PRIORITY_LEVELS / 32) // Each Group is a 32-Bit Word in the Ready Bitmap
+
+#define 	OS_DEFAULT_TIME_SLICE	1 // Round-Robin Time Quantum (in ticks) of the Tasks having Task_Time_Slice = 0
+
+#ifndef OS_TICKLESS_IDLE
+#define 	OS_TICKLESS_IDLE	1 // 1: Stop the Periodic Tick while only the Idle Task is Ready , 0: Periodic Tick always
+#endif
+
+#ifndef OS_TICK_HOOK
+#define 	OS_TICK_HOOK	0 // 1: the Systick calls Samy_OS_Tick_Hook (Defined by the Application) , 0: No Hook
+#endif
+
+#define 	OS_WAIT_FOREVER		0xFFFFFFFF // timeout of the Blocking Waits: Blocks until the Event happens (No timeout)
+
+#ifndef OS_UNPRIVILEGED_TASKS
+#define 	OS_UNPRIVILEGED_TASKS	1 // 1: Tasks run with Unprivileged Access , 0: Privileged Access (e.g. Benchmarks reading the Systick)
+#endif
+
 typedef enum
 {
 	No_Error,
 	Ready_QUEUE_Init_ERROR,
 	Task_Exceeded_Stack_Size,
-	Mutex_Reached_Max_No_Of_Users,
-	Mutex_Already_Acquired
+	Tasks_Reached_Max_Num,
+	Mutex_Reached_Max_No_Of_Users,	// Not Returned anymore (the Mutex Waiters are not Limited) , kept for the Users Code
+	Mutex_Already_Acquired,
+	Semaphore_Count_Overflow,
+	Wait_Timeout,
+	Message_Queue_Init_ERROR,
+	Message_Queue_Full,
+	Wait_Cancelled					// the Blocked Task was Activated again (or Terminated) before its Wait was satisfied
 }Samy_OS_Status;
 
 
-typedef struct
+// Update of the Notification Value of the Notified Task
+typedef enum
+{
+	Notify_Set_Bits,	// Value |= value  (Event Bits)
+	Notify_Increment,	// Value++         (Counting Events , value is not used)
+	Notify_Overwrite	// Value = value   (Latest Value Mailbox)
+}Samy_OS_Notify_Action;
+
+
+// Options of Waiting on an Event Group (Combined by OR: e.g. Event_Wait_All | Event_Clear_On_Exit)
+typedef enum
+{
+	Event_Wait_Any		= 0x00,	// Woken-up when any of the Waited Bits is Set
+	Event_Wait_All		= 0x01,	// Woken-up when all the Waited Bits are Set
+	Event_Clear_On_Exit	= 0x02	// The Waited Bits are Cleared from the Group when the Task is Woken-up
+}Samy_OS_Event_Options;
+
+
+/*
+	Wait Queue of a Kernel Object (Mutex , Semaphore , Event Group , Message Queue): the Tasks Blocked on the Object , sorted by Priority
+	(Same Priority Tasks keep their arrival order) , or by arrival order only (Optional) ===> the Head is always the Next Task to be Woken-up
+*/
+typedef struct Wait_Queue_ref
+{
+	struct Tasks_ref *Head; // Not entered by the user
+	struct Tasks_ref *Tail; // Not entered by the user (Appending in constant time)
+
+	enum
+	{
+		Wait_Queue_Priority_Order,	// Default: the Highest Priority Waiter is Woken-up first
+		Wait_Queue_FIFO_Order		// the Longest Waiting Task is Woken-up first , whatever its Priority
+	}Order; // Optionally entered by the user (Before any Task Blocks on the Object)
+}Wait_Queue_ref;
+
+
+typedef struct Tasks_ref
 {
-	uint8 Task_Name[30];
-	uint8 Task_Priority;
+	uint32 *Current_PSP; 	// Not entered by the user (Must be the First member: accessed by the PendSV_Handler in CortexMX_OS_Porting.c)
+
+	uint8 Task_Name[30];	// Optional Debug Metadata (Not used by the OS , Tasks are identified by their Tasks_ref Address)
+	uint8 Task_Priority;	// Priority at Creation , then the Effective Priority (Raised by the held Mutexes: Priority Ceiling/Inheritance)
+	uint8 Task_Base_Priority;	// Not entered by the user (the Priority at Creation , Restored when the Task holds no Raising Mutex)
 	void (*pf_Task_Entry)(void); // Pointer to the Entry of the Task Function
 	uint32 Task_Stack_Size;
+	uint32 Task_Time_Slice; 		// Round-Robin Time Quantum in ticks between the Same Priority Tasks (0 ===> OS_DEFAULT_TIME_SLICE)
+	uint32 Remaining_Time_Slice; 	// Not entered by the user (Kept while the Task is Preempted by Higher Priority Tasks)
+	uint32 Task_Period;				// 0 ===> Normal Task , Otherwise the OS calls pf_Task_Entry once every Task_Period ticks (the Function returns after each Job)
+	uint32 Task_Last_Release;		// Not entered by the user (Tick of the Last Release of a Periodic Task)
+
+	OS_Register _S_PSP_Task; 	// Not entered by the user
+	OS_Register _E_PSP_Task; 	// Not entered by the user
 
-	uint32 _S_PSP_Task; 	// Not entered by the user
-	uint32 _E_PSP_Task; 	// Not entered by the user
-	uint32 *Current_PSP; 	// Not entered by the user
+	struct Tasks_ref *Ready_Next;	// Not entered by the user (Links the Task in the Ready List of its Priority)
+	struct Tasks_ref *Ready_Prev;	// Not entered by the user
 
 	enum
 	{	// Task States: Suspended , Waiting , Ready , Running
@@ -51,37 +125,146 @@ typedef struct
 			disabled
 		}Task_Blocking_State;
 
-		uint32 ticks;
+		uint32 ticks; // Not entered by the user (Remaining ticks "relative to the previous Task" in the Waiting List)
+
+		struct Tasks_ref *Next; // Not entered by the user (Links the Task in the OS Waiting List)
+		struct Tasks_ref *Prev; // Not entered by the user
 	}Task_Waiting_Time;
 
+	struct
+	{
+		Wait_Queue_ref *p_Wait_Queue; // Not entered by the user (Wait Queue of the Object the Task is Blocked on , NULL if not Blocked)
+		struct Mutex_ref *p_Mutex;	  // Not entered by the user (the Mutex the Task is Blocked on , NULL if not Blocked on a Mutex)
+
+		struct Tasks_ref *Next; // Not entered by the user (Links the Task in the Wait Queue)
+		struct Tasks_ref *Prev; // Not entered by the user
+
+		Samy_OS_Status Wake_Up_Status; // Not entered by the user (Result of the Last Blocking Wait: No_Error , Wait_Timeout , or Wait_Cancelled)
+
+		uint32 Event_Bits;		// Not entered by the user (Bits Waited on an Event Group , then the Group Bits which Woke-up the Task)
+		uint8 Event_Options;	// Not entered by the user (Samy_OS_Event_Options of the Wait)
+
+		void *p_Message;		// Not entered by the user (Message of a Task Blocked on a Message Queue: to be Sent , or the Receive Buffer)
+	}Task_Blocked_On;
+
+	struct
+	{
+		uint32 Value;				// Not entered by the user (Updated by the Notifiers)
+		uint32 Received_Value;		// Not entered by the user (Value at Receiving the Last Notification)
+		uint32 Clear_Bits_On_Exit;	// Not entered by the user (Bits Cleared from Value at Receiving)
+
+		enum
+		{
+			Notification_None,		// No Notification since the Last Received one
+			Notification_Pending,	// Notified , and not yet Received by the Task
+			Notification_Waiting	// The Task is Blocked until a Notification
+		}State;
+	}Task_Notification;
+
+	struct Mutex_ref *Held_Mutexes; // Not entered by the user (List of the Mutexes Owned by the Task , the Last Acquired First)
+
 }Tasks_ref;
 
 
-typedef struct
+typedef struct Mutex_ref
 {
 	uint8 *ptr_PayLoad;
 	uint32 PayLoad_Size;
 
-	Tasks_ref *Current_User;
-	Tasks_ref *Next_User;
+	/*
+		Lock Word (Not entered by the user): the Address of the Owner Task (0 ===> Released) , Claimed and Released by the Tasks
+		with LDREX/STREX , without any SVC while there is no Contention. Bit 0 is Set while the Mutex is managed by the OS
+		(Tasks Blocked on it , or Priority Ceiling) ===> its Release enters the OS to hand it to the Next Owner.
+	*/
+	volatile OS_Register Lock_Word;
+
+	Wait_Queue_ref Waiting_Tasks; // Not entered by the user (Tasks Blocked on Acquiring the Mutex , any Number)
 
-	uint8 Mutex_Name[30];
+	uint8 Mutex_Name[30];	// Optional Debug Metadata (Not used by the OS)
 
+	/*
+		Priority Ceiling (Optional): the Owner Runs at Ceiling_Priority while it holds the Mutex (the Mutex is then
+		Acquired through the OS). Disabled is the Default (Zero-Initialized Mutex) ===> an Uncontended Mutex is Claimed
+		without any SVC. Note: Priority_Ceiling_Enabled used to be the Value 0 , a Mutex relying on the Zero-Initialization
+		for its Ceiling must now Set State = Priority_Ceiling_Enabled explicitly.
+	*/
 	struct
 	{
 		enum
 		{
-			Priority_Ceiling_Enabled,
-			Priority_Ceiling_Disabled
+			Priority_Ceiling_Disabled,	// Default
+			Priority_Ceiling_Enabled
 		}State;
 
 		uint8 Ceiling_Priority;
-		uint8 Old_Priority;
 
 	}Mutex_Priority_Ceiling;
 
+	/*
+		Priority Inheritance (Optional): while Tasks are Blocked on the Mutex , its Owner Runs at the Priority of the Highest Waiter
+		(No Raising without Contention). Transitive: if the Owner is itself Blocked on another Mutex , the Raising follows the
+		Chain of Owners. When a Mutex is Released , its Owner gets the Highest Priority still required by the Mutexes it holds.
+	*/
+	enum
+	{
+		Priority_Inheritance_Disabled,	// Default
+		Priority_Inheritance_Enabled
+	}Mutex_Priority_Inheritance;
+
+	struct Mutex_ref *Next_Held; // Not entered by the user (Links the Mutex in the Held_Mutexes List of its Owner)
+
+	/*
+		Recursive Mutex (Optional): the Owner may Acquire the Mutex again (Layered Drivers) , every Acquiring is Counted
+		by the Owner without any SVC , and the Mutex is Released only by the Release matching its First Acquiring.
+	*/
+	enum
+	{
+		Mutex_Non_Recursive,	// Default (the Owner Acquiring again gets Mutex_Already_Acquired)
+		Mutex_Recursive
+	}Mutex_Type;
+
+	uint32 Nesting_Count; // Not entered by the user (Acquirings of the Owner after its First one , Written by the Owner only)
+
 }Mutex_ref;
 
+
+typedef struct
+{
+	uint32 Count;		// Available Tokens (Initial Value entered by the user)
+	uint32 Max_Count;	// Upper Limit of the Count (0 ===> No Limit , 1 ===> Binary Semaphore)
+
+	Wait_Queue_ref Waiting_Tasks; // Not entered by the user (Tasks Blocked on Taking the Semaphore)
+
+	uint8 Semaphore_Name[30];	// Optional Debug Metadata (Not used by the OS)
+
+}Semaphore_ref;
+
+
+typedef struct
+{
+	vuint32 Event_Bits; // 32 Event Flags (Initial Value entered by the user) , must be in the SRAM (Bit-Band Region) on the Cortex-M3
+
+	Wait_Queue_ref Waiting_Tasks; // Not entered by the user (Tasks Blocked until their Waited Bits are Set)
+
+	uint8 Event_Group_Name[30];	// Optional Debug Metadata (Not used by the OS)
+
+}Event_Group_ref;
+
+
+typedef struct
+{
+	void *p_Buffer;		// Storage of the Messages: Array of Max_Messages * Message_Size Bytes (entered by the user)
+	uint32 Max_Messages;	// Power of 2 (the Ring Indices are Masked)
+	uint32 Message_Size;	// Bytes per Message (the Messages are Copied by Value)
+
+	FIFO_BUFF Messages;			// Not entered by the user (Ring of the Queued Messages)
+	Wait_Queue_ref Receivers;	// Not entered by the user (Tasks Blocked on an Empty Queue)
+	Wait_Queue_ref Senders;		// Not entered by the user (Tasks Blocked on a Full Queue)
+
+	uint8 Message_Queue_Name[30];	// Optional Debug Metadata (Not used by the OS)
+
+}Message_Queue_ref;
+
 /****************************************************************************************************************************/
 
 /************************** User Supported APIs **************************/
@@ -102,6 +285,8 @@ Samy_OS_Status Samy_OS_Init(void);
 * @param[in]    - new_task: Pointer to the Task's Configuration Struct.
 * @return 		- Returns No_Error if no error occured, or specific Error if occured.
 * Note			- The Created Task is initially in the Suspended State after calling this API.
+*				  A Task having Task_Period != 0 is a Periodic Task: its Function is called once every Period (Released at Absolute ticks from its Activation).
+*				  The Task is not Created if the Scheduling Table is Full (MAX_TASKS_NUM) or its Stack exceeds the PSP Stack.
 */
 Samy_OS_Status Samy_OS_Create_Task(Tasks_ref *new_task);
 
@@ -112,6 +297,7 @@ Samy_OS_Status Samy_OS_Create_Task(Tasks_ref *new_task);
 * @param[in]    - p_Task: Pointer to the Task's Configuration Struct.
 * @return 		- None
 * Note			- The Activated Task would Run directly if it has the Highest priority among the other tasks. Otherwise, it is added to the Ready QUEUE to be Scheduled.
+*				  A Task Blocked on an Object , a Notification or a Message Queue is Unlinked from it , and its Blocking API Returns Wait_Cancelled.
 */
 void Samy_OS_Activate_Task(Tasks_ref *p_Task);
 
@@ -141,31 +327,320 @@ void Samy_OS_Start_OS(void);
 * @param[in]    - ticks: amount of ticks for task waiting, until moving to the ready state. 
 * @param[in]    - p_Task: Pointer to the Task's Configuration Struct. 
 * @return 		- None
-* Note			- None.
+* Note			- Waiting for 0 ticks does not block the Task.
 */
 void Samy_OS_Task_Wait(uint32 ticks , Tasks_ref *p_Task);
 
 
+/*==========================================================
+* @Fn			- Samy_OS_Task_Wait_Until
+* @brief 		- Sends the Task to the Waiting state until an Absolute tick: the Previous Release + period.
+* @param[in]    - p_Previous_Release: Tick of the Previous Release , Updated to the Next Release by the OS (Initialized by (uint32)Samy_OS_Get_Tick_Count()).
+* @param[in]    - period: amount of ticks between 2 Releases.
+* @param[in]    - p_Task: Pointer to the Task's Configuration Struct.
+* @return 		- None
+* Note			- Unlike Samy_OS_Task_Wait , the Execution and Preemption time of the Task don't accumulate a Drift.
+*				  If the Next Release has already passed (the Task Overran its Period) , the Task is not Blocked.
+*/
+void Samy_OS_Task_Wait_Until(uint32 *p_Previous_Release , uint32 period , Tasks_ref *p_Task);
+
+
+/*==========================================================
+* @Fn			- Samy_OS_Get_Tick_Count
+* @brief 		- Returns the OS Time.
+* @param[in]    - None
+* @return 		- 64-Bit Number of ticks since starting the OS.
+* Note			- Can be called by the Tasks and the Interrupts , the Returned value is never Half-Updated.
+*/
+uint64 Samy_OS_Get_Tick_Count(void);
+
+
+/*==========================================================
+* @Fn			- Samy_OS_Get_Timestamp
+* @brief 		- Returns a High-Resolution Monotonic Timestamp: the OS ticks combined with the Sub-tick Counter of the Systick.
+* @param[in]    - None
+* @return 		- 64-Bit Timestamp in OS_TICK_PERIOD_CYCLES units per tick (CPU Cycles on the Cortex-M3 , nano-seconds on the Host).
+* Note			- Can be called by the Tasks and the Interrupts. Interrupts and Privileged Tasks read the Systick directly ,
+*				  the Unprivileged Tasks read it through the SVC.
+*/
+uint64 Samy_OS_Get_Timestamp(void);
+
+
+/*==========================================================
+* @Fn			- Samy_OS_Get_Avoided_Context_Switches
+* @brief 		- Returns the number of Scheduling Decisions (Systick , OS Services) which kept the Running Task without Context Switching.
+* @param[in]    - None
+* @return 		- Number of Avoided Context Switches since starting the OS.
+* Note			- The PendSV is only Triggered when the Next Task differs from the Running Task.
+*/
+uint32 Samy_OS_Get_Avoided_Context_Switches(void);
+
+
+/*==========================================================
+* @Fn			- Samy_OS_Get_Current_Task
+* @brief 		- Returns the Running Task (the Caller Task , when called by a Task).
+* @param[in]    - None
+* @return 		- Pointer to the Running Task's Configuration Struct.
+* Note			- Lets a Task Function shared by several Tasks find its own Tasks_ref.
+*/
+Tasks_ref* Samy_OS_Get_Current_Task(void);
+
+#if OS_TICK_HOOK
+/*==========================================================
+* @Fn			- Samy_OS_Tick_Hook
+* @brief 		- Application Hook , called with every OS Time update (Systick , or leaving a Tickless Idle period) before the Scheduling Decision.
+* @param[in]    - elapsed_ticks: ticks elapsed since the previous Hook (1 , or more after a Tickless Idle period).
+* @return 		- None
+* Note			- Defined by the Application when OS_TICK_HOOK = 1 , Runs in Handler Mode (Must be short and must not call the OS APIs).
+*/
+void Samy_OS_Tick_Hook(uint32 elapsed_ticks);
+#endif
+
+/*==========================================================
+* @Fn			- Samy_OS_Switch_Current_Task
+* @brief 		- Makes the Decided Next Task the Running Task (if a Switch is Pending) , and returns the Previous Running Task.
+* @param[in]    - None
+* @return 		- Pointer to the Task Running before the Switch (the New Running Task is returned by Samy_OS_Get_Current_Task).
+* Note			- Called by the PendSV_Handler of the Porting Layers written in C (Host_OS_Porting.c) , with the SysTick Masked ,
+*				  instead of accessing OS_Control (the Cortex-M PendSV_Handler updates it directly in Assembly).
+*/
+Tasks_ref* Samy_OS_Switch_Current_Task(void);
+
+
 /*==========================================================
 * @Fn			- Samy_OS_Acquire_Mutex
 * @brief 		- Acquire Mutex if available
 * @param[in]    - p_Task:  Pointer to the Task's  Configuration Struct.
 * @param[in]    - p_Mutex: Pointer to the Mutex's Configuration Struct. 
 * @return 		- Returns No_Error if no error occured, or specific Error if occured.
-* Note			- Mutex Can be hold by a Maximum of 2 Tasks only (a task already acquires it, while the other is waiting until released).
+* Note			- Any Number of Tasks can Block on a Taken Mutex , they are Queued in Priority order (or FIFO order , See Wait_Queue_ref).
+*				  A Released Mutex is Claimed with LDREX/STREX on its Lock Word , without entering the OS (Except with a Priority Ceiling).
+*				  A Recursive Mutex (Mutex_Type) Acquired again by its Owner is only Counted (No_Error) , without entering the OS.
 */
 Samy_OS_Status Samy_OS_Acquire_Mutex(Tasks_ref *p_Task , Mutex_ref *p_Mutex);
 
 
+/*==========================================================
+* @Fn			- Samy_OS_Acquire_Mutex_Timeout
+* @brief 		- Acquire Mutex if available , or Blocks the Task until the Mutex is handed to it or the timeout expires.
+* @param[in]    - p_Task:  Pointer to the Task's  Configuration Struct.
+* @param[in]    - p_Mutex: Pointer to the Mutex's Configuration Struct.
+* @param[in]    - timeout: Maximum ticks to Wait (0 ===> Don't Block , OS_WAIT_FOREVER ===> No timeout).
+* @return 		- Returns No_Error if the Task owns the Mutex , Wait_Timeout , Wait_Cancelled , or Mutex_Already_Acquired (Non-Recursive Mutex).
+* Note			- At the timeout , the Task is Unlinked from the Mutex Wait Queue in constant time (and the Owners lose its Inherited Priority).
+*/
+Samy_OS_Status Samy_OS_Acquire_Mutex_Timeout(Tasks_ref *p_Task , Mutex_ref *p_Mutex , uint32 timeout);
+
+
+/*==========================================================
+* @Fn			- Samy_OS_Try_Acquire_Mutex
+* @brief 		- Acquire Mutex if available , without Blocking (Samy_OS_Acquire_Mutex_Timeout with timeout = 0).
+* @param[in]    - p_Task:  Pointer to the Task's  Configuration Struct.
+* @param[in]    - p_Mutex: Pointer to the Mutex's Configuration Struct.
+* @return 		- Returns No_Error if the Task owns the Mutex , Wait_Timeout if it is Taken , or Mutex_Already_Acquired (Non-Recursive Mutex).
+*/
+Samy_OS_Status Samy_OS_Try_Acquire_Mutex(Tasks_ref *p_Task , Mutex_ref *p_Mutex);
+
+
 /*==========================================================
 * @Fn			- Samy_OS_Release_Mutex
-* @brief 		- Release Mutex and acquires it to the other task waiting for that Mutex (if found).
+* @brief 		- Release Mutex and acquires it to the Head task waiting for that Mutex (if found) , in constant time.
 * @param[in]    - p_Mutex: Pointer to the Mutex's Configuration Struct. 
 * @return 		- Returns No_Error if no error occured, or specific Error if occured.
-* Note			- Mutex is Released if and only if it was acquired by the Same task, not any other tasks. 
+* Note			- Mutex is Released if and only if it was acquired by the Same task, not any other tasks. (a Release by any other Task is Ignored)
+*				  Without Waiters (and Priority Ceiling) , the Lock Word is Cleared with LDREX/STREX , without entering the OS.
+*				  A Recursive Mutex is kept by its Owner until the Release matching its First Acquiring (Nested ones are only Counted).
 */
 
 void Samy_OS_Release_Mutex(Mutex_ref *p_Mutex);
 
 
+/*==========================================================
+* @Fn			- Samy_OS_Take_Semaphore
+* @brief 		- Takes a Token of the Semaphore , or Blocks the Task until a Token is Given.
+* @param[in]    - p_Task:      Pointer to the Task's Configuration Struct.
+* @param[in]    - p_Semaphore: Pointer to the Semaphore's Configuration Struct.
+* @return 		- Returns No_Error when the Task holds the Token.
+* Note			- Any number of Tasks can be Blocked on the Semaphore , they get the Tokens in Priority order
+*				  (the Same Priority Tasks in their arrival order).
+*/
+Samy_OS_Status Samy_OS_Take_Semaphore(Tasks_ref *p_Task , Semaphore_ref *p_Semaphore);
+
+
+/*==========================================================
+* @Fn			- Samy_OS_Take_Semaphore_Timeout
+* @brief 		- Takes a Token of the Semaphore , or Blocks the Task until a Token is Given or the timeout expires.
+* @param[in]    - p_Task:      Pointer to the Task's Configuration Struct.
+* @param[in]    - p_Semaphore: Pointer to the Semaphore's Configuration Struct.
+* @param[in]    - timeout:     Maximum ticks to Wait (0 ===> Don't Block , OS_WAIT_FOREVER ===> No timeout).
+* @return 		- Returns No_Error when the Task holds the Token , Wait_Timeout , or Wait_Cancelled.
+* Note			- At the timeout , the Task is Unlinked from the Semaphore Wait Queue in constant time.
+*/
+Samy_OS_Status Samy_OS_Take_Semaphore_Timeout(Tasks_ref *p_Task , Semaphore_ref *p_Semaphore , uint32 timeout);
+
+
+/*==========================================================
+* @Fn			- Samy_OS_Try_Take_Semaphore
+* @brief 		- Takes a Token of the Semaphore if available , without Blocking (Samy_OS_Take_Semaphore_Timeout with timeout = 0).
+* @param[in]    - p_Task:      Pointer to the Task's Configuration Struct.
+* @param[in]    - p_Semaphore: Pointer to the Semaphore's Configuration Struct.
+* @return 		- Returns No_Error when the Task holds the Token , or Wait_Timeout if no Token is available.
+*/
+Samy_OS_Status Samy_OS_Try_Take_Semaphore(Tasks_ref *p_Task , Semaphore_ref *p_Semaphore);
+
+
+/*==========================================================
+* @Fn			- Samy_OS_Give_Semaphore
+* @brief 		- Gives a Token to the Highest Priority Blocked Task , or adds it to the Semaphore Count if no Task is Blocked.
+* @param[in]    - p_Semaphore: Pointer to the Semaphore's Configuration Struct.
+* @return 		- Returns No_Error if no error occured, or Semaphore_Count_Overflow if the Count already reached Max_Count.
+* Note			- Readying the Blocked Task costs a constant time , whatever the number of Blocked or Ready Tasks.
+*/
+Samy_OS_Status Samy_OS_Give_Semaphore(Semaphore_ref *p_Semaphore);
+
+
+/*==========================================================
+* @Fn			- Samy_OS_Give_Semaphore_From_ISR
+* @brief 		- Same as Samy_OS_Give_Semaphore , called by the Interrupts Handlers.
+* @param[in]    - p_Semaphore: Pointer to the Semaphore's Configuration Struct.
+* @return 		- Returns No_Error if no error occured, or Semaphore_Count_Overflow if the Count already reached Max_Count.
+* Note			- Executed directly with the Interrupts Masked (No SVC) , the Context Switching (if any) happens when the Interrupts return.
+*/
+Samy_OS_Status Samy_OS_Give_Semaphore_From_ISR(Semaphore_ref *p_Semaphore);
+
+
+/*==========================================================
+* @Fn			- Samy_OS_Notify_Task
+* @brief 		- Updates the Notification Value of the Task , and Readies it if it is Waiting for a Notification.
+* @param[in]    - p_Task: Pointer to the Notified Task's Configuration Struct.
+* @param[in]    - value:  Bits to Set , or the New Value (Not used by Notify_Increment).
+* @param[in]    - action: Notify_Set_Bits , Notify_Increment or Notify_Overwrite.
+* @return 		- Returns No_Error.
+* Note			- No Kernel Object is needed: each Task has one Notification Value (a Lightweight Binary/Counting Semaphore or Event Bits).
+*/
+Samy_OS_Status Samy_OS_Notify_Task(Tasks_ref *p_Task , uint32 value , Samy_OS_Notify_Action action);
+
+
+/*==========================================================
+* @Fn			- Samy_OS_Notify_Task_From_ISR
+* @brief 		- Same as Samy_OS_Notify_Task , called by the Interrupts Handlers.
+* @param[in]    - p_Task: Pointer to the Notified Task's Configuration Struct.
+* @param[in]    - value:  Bits to Set , or the New Value (Not used by Notify_Increment).
+* @param[in]    - action: Notify_Set_Bits , Notify_Increment or Notify_Overwrite.
+* @return 		- Returns No_Error.
+* Note			- Executed directly with the Interrupts Masked (No SVC) , the Context Switching (if any) happens when the Interrupts return.
+*/
+Samy_OS_Status Samy_OS_Notify_Task_From_ISR(Tasks_ref *p_Task , uint32 value , Samy_OS_Notify_Action action);
+
+
+/*==========================================================
+* @Fn			- Samy_OS_Wait_Notification
+* @brief 		- Receives the Notification of the Task , or Blocks the Task until it is Notified or the timeout expires.
+* @param[in]    - p_Task: Pointer to the Task's Configuration Struct (the Caller Task).
+* @param[in]    - clear_bits_on_exit: Bits Cleared from the Notification Value after Receiving it (0xFFFFFFFF ===> Reset the Value).
+* @param[out]   - p_Value: the Notification Value before Clearing the Bits , Written only if a Notification was Received (can be NULL).
+* @param[in]    - timeout: Maximum ticks to Wait (0 ===> Don't Block , OS_WAIT_FOREVER ===> No timeout).
+* @return 		- Returns No_Error if a Notification was Received , Wait_Timeout , or Wait_Cancelled.
+* Note			- a Notification sent before the Wait is not lost: it is Received without Blocking.
+*/
+Samy_OS_Status Samy_OS_Wait_Notification(Tasks_ref *p_Task , uint32 clear_bits_on_exit , uint32 *p_Value , uint32 timeout);
+
+
+/*==========================================================
+* @Fn			- Samy_OS_Set_Event_Bits
+* @brief 		- Sets Bits of the Event Group , and Readies all the Tasks whose Wait is satisfied.
+* @param[in]    - p_Event_Group: Pointer to the Event Group's Configuration Struct.
+* @param[in]    - bits: Bits to Set.
+* @return 		- Returns No_Error.
+* Note			- The Bits Waited with Event_Clear_On_Exit are Cleared after checking all the Blocked Tasks
+*				  (All the Tasks Waiting on the Same Bits are Woken-up together).
+*/
+Samy_OS_Status Samy_OS_Set_Event_Bits(Event_Group_ref *p_Event_Group , uint32 bits);
+
+
+/*==========================================================
+* @Fn			- Samy_OS_Set_Event_Bits_From_ISR
+* @brief 		- Same as Samy_OS_Set_Event_Bits , called by the Interrupts Handlers.
+* @param[in]    - p_Event_Group: Pointer to the Event Group's Configuration Struct.
+* @param[in]    - bits: Bits to Set.
+* @return 		- Returns No_Error.
+* Note			- The Bits are Set atomically without Masking the Interrupts (Bit-Band Stores on the Cortex-M3) ,
+*				  the Interrupts are Masked only to Ready the Blocked Tasks (if any).
+*/
+Samy_OS_Status Samy_OS_Set_Event_Bits_From_ISR(Event_Group_ref *p_Event_Group , uint32 bits);
+
+
+/*==========================================================
+* @Fn			- Samy_OS_Clear_Event_Bits
+* @brief 		- Clears Bits of the Event Group.
+* @param[in]    - p_Event_Group: Pointer to the Event Group's Configuration Struct.
+* @param[in]    - bits: Bits to Clear.
+* @return 		- Returns No_Error.
+* Note			- Can be called by the Tasks and the Interrupts (Atomic Bit-Band Stores on the Cortex-M3 , No SVC is needed).
+*/
+Samy_OS_Status Samy_OS_Clear_Event_Bits(Event_Group_ref *p_Event_Group , uint32 bits);
+
+
+/*==========================================================
+* @Fn			- Samy_OS_Wait_Event_Bits
+* @brief 		- Blocks the Task until any/all of the Bits are Set in the Event Group , or the timeout expires.
+* @param[in]    - p_Task:        Pointer to the Task's Configuration Struct (the Caller Task).
+* @param[in]    - p_Event_Group: Pointer to the Event Group's Configuration Struct.
+* @param[in]    - bits:          Bits to Wait for.
+* @param[in]    - options:       Event_Wait_Any or Event_Wait_All , optionally combined with Event_Clear_On_Exit.
+* @param[out]   - p_Event_Bits:  the Group Bits which satisfied the Wait (before Clearing) , Written only if No_Error (can be NULL).
+* @param[in]    - timeout:       Maximum ticks to Wait (0 ===> Don't Block , OS_WAIT_FOREVER ===> No timeout).
+* @return 		- Returns No_Error if the Wait was satisfied , Wait_Timeout , or Wait_Cancelled.
+* Note			- The Task is not Blocked if the Bits are already Set.
+*/
+Samy_OS_Status Samy_OS_Wait_Event_Bits(Tasks_ref *p_Task , Event_Group_ref *p_Event_Group , uint32 bits , uint8 options , uint32 *p_Event_Bits , uint32 timeout);
+
+
+/*==========================================================
+* @Fn			- Samy_OS_Create_Message_Queue
+* @brief 		- Initializes the Ring of the Message Queue on its Buffer.
+* @param[in]    - p_Message_Queue: Pointer to the Message Queue's Configuration Struct.
+* @return 		- Returns No_Error , or Message_Queue_Init_ERROR if the Buffer or Message_Size is not entered , or Max_Messages is not a Power of 2.
+* Note			- Must be called before Sending/Receiving any Message.
+*/
+Samy_OS_Status Samy_OS_Create_Message_Queue(Message_Queue_ref *p_Message_Queue);
+
+
+/*==========================================================
+* @Fn			- Samy_OS_Send_Message
+* @brief 		- Copies the Message to the Queue , or Blocks the Task while the Queue is Full until the timeout expires.
+* @param[in]    - p_Task:          Pointer to the Task's Configuration Struct (the Caller Task).
+* @param[in]    - p_Message_Queue: Pointer to the Message Queue's Configuration Struct.
+* @param[in]    - p_Message:       Pointer to the Message (Message_Size Bytes).
+* @param[in]    - timeout:         Maximum ticks to Wait (0 ===> Don't Block , OS_WAIT_FOREVER ===> No timeout).
+* @return 		- Returns No_Error if the Message was Sent , Wait_Timeout , or Wait_Cancelled.
+* Note			- If a Task is Blocked on Receiving , the Message is Copied directly to it , and it is Readied in constant time.
+*/
+Samy_OS_Status Samy_OS_Send_Message(Tasks_ref *p_Task , Message_Queue_ref *p_Message_Queue , const void *p_Message , uint32 timeout);
+
+
+/*==========================================================
+* @Fn			- Samy_OS_Send_Message_From_ISR
+* @brief 		- Same as Samy_OS_Send_Message without Blocking , called by the Interrupts Handlers.
+* @param[in]    - p_Message_Queue: Pointer to the Message Queue's Configuration Struct.
+* @param[in]    - p_Message:       Pointer to the Message (Message_Size Bytes).
+* @return 		- Returns No_Error if the Message was Sent , or Message_Queue_Full.
+* Note			- Executed directly with the Interrupts Masked (No SVC) , the Context Switching (if any) happens when the Interrupts return.
+*/
+Samy_OS_Status Samy_OS_Send_Message_From_ISR(Message_Queue_ref *p_Message_Queue , const void *p_Message);
+
+
+/*==========================================================
+* @Fn			- Samy_OS_Receive_Message
+* @brief 		- Copies the Oldest Message of the Queue , or Blocks the Task while the Queue is Empty until the timeout expires.
+* @param[in]    - p_Task:          Pointer to the Task's Configuration Struct (the Caller Task).
+* @param[in]    - p_Message_Queue: Pointer to the Message Queue's Configuration Struct.
+* @param[out]   - p_Message:       Pointer to the Receive Buffer (Message_Size Bytes).
+* @param[in]    - timeout:         Maximum ticks to Wait (0 ===> Don't Block , OS_WAIT_FOREVER ===> No timeout).
+* @return 		- Returns No_Error if a Message was Received , Wait_Timeout , or Wait_Cancelled.
+* Note			- If a Task is Blocked on Sending , its Message takes the Freed Place , and it is Readied in constant time.
+*/
+Samy_OS_Status Samy_OS_Receive_Message(Tasks_ref *p_Task , Message_Queue_ref *p_Message_Queue , void *p_Message , uint32 timeout);
+
+
 #endif /* SCHEDULER_H_ */